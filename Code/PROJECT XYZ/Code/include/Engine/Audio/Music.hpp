@@ -14,6 +14,15 @@ namespace Sonar
         */
         Music( const std::string &filepath );
 
+        /**
+         * \brief Class constructor with the music file already in memory
+         *
+         * \param filepath Filepath the music file was read from
+         * \param data Contents of the music file (must stay valid for the lifetime of the music as it is streamed)
+         * \param size Size of the contents in bytes
+        */
+        Music( const std::string &filepath, const void *data, const std::size_t &size );
+
         /**
         * \brief Default constructor
         */
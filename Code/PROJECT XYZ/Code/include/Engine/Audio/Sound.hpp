@@ -14,6 +14,15 @@ namespace Sonar
         */
         Sound( const std::string &filepath );
 
+        /**
+         * \brief Class constructor with the sound file already in memory
+         *
+         * \param filepath Filepath the sound file was read from
+         * \param data Contents of the sound file
+         * \param size Size of the contents in bytes
+        */
+        Sound( const std::string &filepath, const void *data, const std::size_t &size );
+
         /**
         * \brief Default constructor
         */
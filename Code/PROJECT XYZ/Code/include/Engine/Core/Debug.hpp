@@ -20,6 +20,10 @@ namespace Sonar
         float _FPS;
         float _frameTime; // CALCULATED AND STORED IN MILLISECONDS
         unsigned long long int _totalFrames = 0;
+        unsigned int _batches = 0; // DRAW CALLS ISSUED BY THE RENDER QUEUE
+        unsigned int _vertices = 0;
+        unsigned int _submissions = 0;
+        unsigned int _culled = 0; // OBJECTS SKIPPED FOR BEING OUTSIDE THE VIEW
     };
 
     /**
@@ -167,6 +171,16 @@ namespace Sonar
         */
         void UpdateFrameData( const float frameTime );
 
+        /**
+        * \brief Update the render statistics for the last frame
+        *
+        * \param batches Number of draw calls issued
+        * \param vertices Number of vertices drawn
+        * \param submissions Number of objects submitted to be drawn
+        * \param culled Number of objects culled
+        */
+        void UpdateRenderData( const unsigned int batches, const unsigned int vertices, const unsigned int submissions, const unsigned int culled );
+
         /**
         * \brief Get the system information (CPU, Memory, GPU, OS, Motherboard stats)
         *
@@ -349,7 +363,33 @@ namespace Sonar
         */
         [[nodiscard]] const bool &IsBorderEnabled( ) const;
 
+        /**
+        * \brief Get the grid and border lines as triangles, rebuilt only when the window size or grid settings have changed
+        *
+        * \param windowSize Size of the window
+        *
+        * \return Output returns the grid vertices, drawn with a single draw call
+        */
+        [[nodiscard]] const sf::VertexArray &GetGridVertices( const glm::uvec2 &windowSize );
+
     private:
+        /**
+        * \brief Rebuild the grid vertices
+        *
+        * \param windowSize Size of the window
+        */
+        void BuildGrid( const glm::uvec2 &windowSize );
+
+        /**
+        * \brief Add a filled rectangle to the grid vertices
+        *
+        * \param x X position of the rectangle
+        * \param y Y position of the rectangle
+        * \param width Width of the rectangle
+        * \param height Height of the rectangle
+        */
+        void AddGridLine( const float &x, const float &y, const float &width, const float &height );
+
         /**
          * \brief Class constructor
         */
@@ -410,5 +450,20 @@ namespace Sonar
         */
         DebugGrid _grid;
 
+        /**
+        * \brief Cached grid geometry
+        */
+        sf::VertexArray _gridVertices;
+
+        /**
+        * \brief Window size the grid geometry was built for
+        */
+        glm::uvec2 _gridWindowSize;
+
+        /**
+        * \brief Have the grid settings changed since the geometry was built
+        */
+        bool _isGridDirty = true;
+
     };
 }
@@ -48,6 +48,139 @@
 */
 #define SHOW_SYSTEM_STATS_OVERLAY_ON_LAUNCH true
 
+/**
+* \brief Whether or not the game updates on a simulation thread separate from the render thread by default
+*/
+#define DEFAULT_IS_GAME_THREADED false
+
+/**
+* \brief Pixels per Box2D meter, every conversion between world and physics units uses this
+*/
+#define PHYSICS_PIXELS_PER_METER 32.0f
+
+/**
+* \brief Gravity of the physics world in pixels per second squared
+*/
+#define DEFAULT_PHYSICS_GRAVITY glm::vec2( 0.0f, 0.0f )
+
+/**
+* \brief Box2D velocity solver iterations per fixed step
+*/
+#define DEFAULT_PHYSICS_VELOCITY_ITERATIONS 8
+
+/**
+* \brief Box2D position solver iterations per fixed step
+*/
+#define DEFAULT_PHYSICS_POSITION_ITERATIONS 3
+
+/**
+* \brief Whether or not each physics step runs on its own thread, overlapping drawing one fixed step ahead, by default
+*/
+#define DEFAULT_IS_PHYSICS_THREADED false
+
+/**
+* \brief Default width and height of a collision world cell in world units
+*/
+#define DEFAULT_COLLISION_WORLD_CELL_SIZE 128.0f
+
+/**
+* \brief Colliders covering more collision world cells than this are kept in a list every query checks instead of being stored in each cell
+*/
+#define COLLISION_WORLD_MAX_COLLIDER_CELLS 16
+
+/**
+* \brief Maximum number of component types an entity component system registry can use, one bit of a component mask each
+*/
+#define ECS_MAX_COMPONENT_TYPES 64
+
+/**
+* \brief Number of rows an archetype first makes room for, doubled whenever it fills up
+*/
+#define ECS_ARCHETYPE_INITIAL_CAPACITY 64
+
+/**
+* \brief Default minimum number of entities each job handles when a view is iterated in parallel
+*/
+#define DEFAULT_ECS_PARALLEL_GRAIN_SIZE 1024
+
+/**
+* \brief Number of job system worker threads, 0 uses one less than the number of cores
+*/
+#define DEFAULT_JOB_SYSTEM_THREAD_COUNT 0
+
+/**
+* \brief Whether or not consecutive draws sharing a texture are merged into a single draw call on launch
+*/
+#define DEFAULT_IS_RENDER_BATCHING_ENABLED true
+
+/**
+* \brief Whether or not submissions are sorted by layer and depth before being drawn on launch
+*/
+#define DEFAULT_IS_RENDER_SORTING_ENABLED true
+
+/**
+* \brief Whether or not submissions on the same layer and depth are grouped by texture and blend mode on launch (overlapping objects then need different depths to keep their order)
+*/
+#define DEFAULT_IS_RENDER_STATE_SORTING_ENABLED false
+
+/**
+* \brief Furthest a circle's edges may sit inside the true circle in pixels, circles get just enough points to stay within it (never more than their point count)
+*/
+#define DEFAULT_RENDER_CIRCLE_TOLERANCE 0.25f
+
+/**
+* \brief Fewest points a circle is drawn with
+*/
+#define DEFAULT_RENDER_CIRCLE_MINIMUM_POINT_COUNT 8
+
+/**
+* \brief Default width and height of a culling grid cell in world units, objects bigger than a cell are kept in a list every query checks
+*/
+#define DEFAULT_CULLING_GRID_CELL_SIZE 256.0f
+
+/**
+* \brief Default width and height of a tile map chunk in tiles
+*/
+#define DEFAULT_TILE_MAP_CHUNK_SIZE 32
+
+/**
+* \brief Default particle emitter properties
+*/
+#define DEFAULT_PARTICLE_EMITTER_CAPACITY 10000
+#define DEFAULT_PARTICLE_SPEED 100.0f
+#define DEFAULT_PARTICLE_LIFETIME 1.0f
+#define DEFAULT_PARTICLE_SIZE 4.0f
+
+/**
+* \brief Width and height of each texture atlas page in pixels
+*/
+#define DEFAULT_TEXTURE_ATLAS_PAGE_SIZE 2048
+
+/**
+* \brief Empty pixels left between images packed into a texture atlas
+*/
+#define DEFAULT_TEXTURE_ATLAS_PADDING 1
+
+/**
+* \brief Number of worker threads the asset manager decodes files on
+*/
+#define DEFAULT_ASSET_LOADER_THREAD_COUNT 2
+
+/**
+* \brief Maximum number of asynchronously loaded assets finished (uploaded to the GPU) per frame
+*/
+#define DEFAULT_ASSET_UPLOADS_PER_FRAME 4
+
+/**
+* \brief Whether or not decoded images are cached on disk so later launches skip decoding them
+*/
+#define DEFAULT_IS_IMAGE_DISK_CACHE_ENABLED false
+
+/**
+* \brief Directory decoded images are cached in
+*/
+#define DEFAULT_IMAGE_DISK_CACHE_DIRECTORY "Cache/Images"
+
 /**
 * \brief Default name for scores in the high score manager that aren't set
 */
@@ -199,6 +332,7 @@
 * \brief Default menu properties
 */
 #define DEFAULT_MENU_THEME Sonar::MenuComponent::Theme::DARK
+#define DEFAULT_IS_MENU_CACHING_ENABLED false
 
 /**
 * \brief Default button group properties
@@ -225,6 +359,8 @@
 #define DEFAULT_MINIMAP_INTERNAL_MAP_HEIGHT DEFAULT_MINIMAP_BACKGROUND_HEIGHT
 #define DEFAULT_MINIMAP_OBJECT_RADIUS 2.0f
 #define DEFAULT_MINIMAP_OBJECT_COLOR Color::Red
+#define DEFAULT_MINIMAP_OBJECT_POINT_COUNT 12
+#define DEFAULT_MINIMAP_CACHE_REFRESH_RATE 10.0f
 
 /**
 * \brief Default background properties
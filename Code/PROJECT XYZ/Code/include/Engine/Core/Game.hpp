@@ -1,8 +1,11 @@
 #pragma once
 
+#include "Core/JobSystem.hpp"
 #include "Core/StateMachine.hpp"
 #include "Core/Window.hpp"
+#include "Graphics/RenderQueue.hpp"
 #include "Managers/AssetManager.hpp"
+#include "Physics/Physics.hpp"
 
 namespace Sonar
 {
@@ -11,13 +14,15 @@ namespace Sonar
     */
 	struct GameData
 	{
+		Physics physics; // Physics world, declared first so it outlives the states' drawables
 		StateMachine machine; // State machine to handle the states
 		Window window; // Game window
 		AssetManager assets; // Asset manager
+		RenderQueue renderQueue; // Batches draw calls for the frame
+		JobSystem jobs; // Spreads work across the cores
         Debug *debug; // Debugger
         Color backgroundColor = DEFAULT_BACKGROUND_CLEAR_COLOR;
         float dt;
-        b2World *world;
         b2GLDraw fooDrawInstance;
 	};
     
@@ -29,14 +34,35 @@ namespace Sonar
 	class Game
 	{
 	public:
+        /**
+         * \brief Settings of a game run without a window
+        */
+        struct HeadlessSettings
+        {
+            bool _isRendered = true; // Draw each frame to an offscreen texture
+            unsigned int _frameLimit = 0; // Stop after this many frames, 0 for no limit
+            float _timeLimit = 0.0f; // Stop after this many seconds of game time, 0 for no limit
+            bool _isRealTime = false; // Pace frames with the clock, otherwise every frame is one fixed step and runs as fast as possible (deterministic)
+        };
+
         /**
          * \brief Class constructor
          *
          * \param width Game window width
          * \param height Game window height
          * \param title Game window title
+         * \param isThreaded Whether or not the fixed step updates run on their own thread, letting the render thread wait on vsync without holding up the simulation
+        */
+		Game( const int &width, const int &height, const std::string &title, const bool &isThreaded = DEFAULT_IS_GAME_THREADED );
+
+        /**
+         * \brief Class constructor for a headless game (CI, benchmarks, servers)
+         *
+         * \param width Offscreen target width
+         * \param height Offscreen target height
+         * \param settings Headless settings
         */
-		Game( const int &width, const int &height, const std::string &title );
+		Game( const int &width, const int &height, const HeadlessSettings &settings );
                         
 	private:
         /**
@@ -59,11 +85,86 @@ namespace Sonar
         */
 		GameDataRef _data = std::make_shared<GameData>( );
 
+        /**
+         * \brief Is the simulation run on its own thread
+        */
+        bool _isThreaded;
+
+        /**
+         * \brief Keeps the simulation thread running
+        */
+        std::atomic<bool> _isSimulationRunning;
+
+        /**
+         * \brief Stops the simulation and render threads touching the states at the same time, the render thread only takes it to close the window
+        */
+        std::mutex _stateMutex;
+
+        /**
+         * \brief Guards the ImGui context and the debug overlay's data, the simulation thread builds the interface and the render thread renders it
+        */
+        std::mutex _imGUIMutex;
+
+        /**
+         * \brief Guards the events waiting for the simulation thread
+        */
+        std::mutex _eventMutex;
+
+        /**
+         * \brief Events polled by the render thread waiting for the simulation thread
+        */
+        std::vector<Event> _pendingEvents;
+
+        /**
+         * \brief Headless settings, only used when the window is headless
+        */
+        HeadlessSettings _headlessSettings;
+
+        /**
+         * \brief Create the first state and the physics world, shared by the constructors
+        */
+		void Init( );
+
+        /**
+         * \brief Has the headless run reached its frame or time limit
+         *
+         * \param frames Frames run so far
+         * \param time Game time run so far
+         *
+         * \return Output returns true if the run should stop
+        */
+		[[nodiscard]] bool IsHeadlessLimitReached( const unsigned int &frames, const float &time ) const;
+
         /**
          * \brief Run the game
         */
 		void Run( );
 
+        /**
+         * \brief Run the game with the simulation on its own thread, this thread polls events and draws and presents the snapshots it publishes
+        */
+		void RunThreaded( );
+
+        /**
+         * \brief Simulation thread loop, runs the fixed step updates and records a snapshot of the frame after each one
+        */
+		void Simulate( );
+
+        /**
+         * \brief Record the active state's frame and the interface into a snapshot and publish it for the render thread
+        */
+		void RecordFrame( );
+
+        /**
+         * \brief Draw the active state and the debug overlays
+        */
+		void DrawFrame( );
+
+        /**
+         * \brief Display the frame and store its render statistics
+        */
+		void PresentFrame( );
+
         
         
 	};
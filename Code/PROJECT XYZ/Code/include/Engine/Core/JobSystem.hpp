@@ -0,0 +1,219 @@
+#pragma once
+
+namespace Sonar
+{
+    /**
+    * \brief Number of jobs still to finish, jobs run with a counter decrement it when done
+    */
+    struct JobCounter
+    {
+        std::atomic<unsigned int> _value{ 0 };
+        std::exception_ptr _exception; // First exception thrown by a job run with the counter, rethrown by Wait
+        std::mutex _exceptionMutex;
+    };
+
+    /**
+    * \brief Set of tasks with dependencies between them, run with JobSystem::Run
+    */
+    class JobGraph
+    {
+    public:
+        /**
+        * \brief Add a task to the graph
+        *
+        * \param task Function to be run
+        * \param dependencies Tasks (as returned by AddTask) that must finish before this one starts
+        *
+        * \return Output returns the task's identifier
+        */
+        unsigned int AddTask( std::function<void( )> task, const std::vector<unsigned int> &dependencies = { } );
+
+        /**
+        * \brief Remove every task
+        */
+        void Clear( );
+
+        /**
+        * \brief Get the number of tasks
+        *
+        * \return Output returns the number of tasks
+        */
+        [[nodiscard]] unsigned int GetTaskCount( ) const;
+
+    private:
+        friend class JobSystem;
+
+        /**
+        * \brief Task and the tasks waiting on it
+        */
+        struct Node
+        {
+            std::function<void( )> _task;
+            std::vector<unsigned int> _dependents;
+            unsigned int _dependencyCount = 0;
+            std::unique_ptr<std::atomic<unsigned int>> _remaining; // Dependencies left while the graph runs
+        };
+
+        /**
+        * \brief Tasks of the graph
+        */
+        std::vector<Node> _nodes;
+
+    };
+
+    class JobSystem
+    {
+    public:
+        /**
+        * \brief Class constructor
+        *
+        * \param threadCount Number of worker threads, 0 uses one less than the number of cores and at least one (the thread waiting on jobs also runs them)
+        */
+        JobSystem( const unsigned int &threadCount = DEFAULT_JOB_SYSTEM_THREAD_COUNT );
+
+        /**
+        * \brief Class destructor, finishes queued jobs and stops the workers
+        */
+        ~JobSystem( );
+
+        JobSystem( const JobSystem & ) = delete;
+        JobSystem &operator=( const JobSystem & ) = delete;
+
+        /**
+        * \brief Queue a job, an exception thrown by the job is rethrown by Wait on its counter (and logged and dropped if it has none)
+        *
+        * \param job Function to be run
+        * \param counter Counter incremented now and decremented once the job has run (optional)
+        */
+        void Run( std::function<void( )> job, JobCounter *counter = nullptr );
+
+        /**
+        * \brief Queue every task of a graph, tasks start once their dependencies have finished
+        *
+        * \param graph Graph to run (must stay alive and unchanged until the counter reaches zero)
+        * \param counter Counter incremented by the number of tasks and decremented as each one finishes
+        */
+        void Run( JobGraph &graph, JobCounter &counter );
+
+        /**
+        * \brief Wait for a counter to reach zero, queued jobs are run by the waiting thread in the meantime
+        *
+        * \param counter Counter to wait on, the first exception thrown by one of its jobs is rethrown once every job has finished
+        */
+        void Wait( JobCounter &counter );
+
+        /**
+        * \brief Split a range into chunks run across the workers and wait for all of them, the first exception thrown by a chunk is rethrown once every chunk has finished
+        *
+        * \param count Number of items
+        * \param grainSize Minimum number of items per chunk
+        * \param body Function called with the first and one past the last item of each chunk
+        */
+        void ParallelFor( const unsigned int &count, const unsigned int &grainSize, const std::function<void( unsigned int, unsigned int )> &body );
+
+        /**
+        * \brief Get the number of worker threads
+        *
+        * \return Output returns the number of threads
+        */
+        [[nodiscard]] unsigned int GetThreadCount( ) const;
+
+    private:
+        /**
+        * \brief Jobs owned by a worker, the owner takes from the back and other threads steal from the front
+        */
+        struct Queue
+        {
+            std::deque<std::function<void( )>> _jobs;
+            std::mutex _mutex;
+        };
+
+        /**
+        * \brief Add a job to a queue, the calling worker's own queue if it is a worker
+        *
+        * \param job Job to add
+        */
+        void Push( std::function<void( )> job );
+
+        /**
+        * \brief Take a job, from the calling worker's own queue first and then by stealing
+        *
+        * \param job Job taken
+        *
+        * \return Output returns true if a job was taken
+        */
+        bool Pop( std::function<void( )> &job );
+
+        /**
+        * \brief Run a job, keeping an exception it throws in a counter instead of letting it leave the thread
+        *
+        * \param job Job to run
+        * \param counter Counter the exception is kept in
+        */
+        static void RunCatching( const std::function<void( )> &job, JobCounter &counter );
+
+        /**
+        * \brief Run one queued job if there is one
+        *
+        * \return Output returns true if a job was run
+        */
+        bool RunOne( );
+
+        /**
+        * \brief Mark a graph task finished and queue the tasks it unblocks
+        *
+        * \param graph Graph being run
+        * \param index Task that finished
+        * \param counter Counter of the graph
+        */
+        void FinishTask( JobGraph &graph, const unsigned int &index, JobCounter &counter );
+
+        /**
+        * \brief Queue a graph task
+        *
+        * \param graph Graph being run
+        * \param index Task to queue
+        * \param counter Counter of the graph
+        */
+        void QueueTask( JobGraph &graph, const unsigned int &index, JobCounter &counter );
+
+        /**
+        * \brief Loop run by each worker thread
+        *
+        * \param index Index of the worker
+        */
+        void Work( const unsigned int &index );
+
+        /**
+        * \brief One queue per worker
+        */
+        std::vector<std::unique_ptr<Queue>> _queues;
+
+        /**
+        * \brief Worker threads
+        */
+        std::vector<std::thread> _workers;
+
+        /**
+        * \brief Number of queued jobs not yet taken
+        */
+        std::atomic<unsigned int> _queuedJobs;
+
+        /**
+        * \brief Queue jobs from non worker threads go to next
+        */
+        std::atomic<unsigned int> _nextQueue;
+
+        /**
+        * \brief Are the workers shutting down
+        */
+        std::atomic<bool> _isStopping;
+
+        /**
+        * \brief Wakes sleeping workers when jobs are queued
+        */
+        std::mutex _sleepMutex;
+        std::condition_variable _sleepCondition;
+
+    };
+}
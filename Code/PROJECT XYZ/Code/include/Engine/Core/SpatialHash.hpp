@@ -0,0 +1,79 @@
+#pragma once
+
+namespace Sonar
+{
+	/**
+	* \brief Cell helpers shared by the grids that hash world space into square cells (CullingGrid and CollisionWorld)
+	*/
+	class SpatialHash
+	{
+	public:
+		/**
+		* \brief Get the key of a cell
+		*
+		* \param x Cell column
+		* \param y Cell row
+		*
+		* \return Output returns the cell's key
+		*/
+		[[nodiscard]] static std::int64_t GetCellKey( const int &x, const int &y );
+
+		/**
+		* \brief Get the cell a key belongs to
+		*
+		* \param key Cell's key
+		*
+		* \return Output returns the cell's column and row
+		*/
+		[[nodiscard]] static glm::ivec2 GetCellFromKey( const std::int64_t &key );
+
+		/**
+		* \brief Get the cell a point is in
+		*
+		* \param point World space point
+		* \param cellSize Width and height of each cell
+		*
+		* \return Output returns the cell's column and row
+		*/
+		[[nodiscard]] static glm::ivec2 GetCell( const glm::vec2 &point, const float &cellSize );
+
+		/**
+		* \brief Call a function for every occupied cell in a range, walking whichever is fewer of the cells in the range or the occupied cells
+		*
+		* \param cells Occupied cells by key
+		* \param range Cells to visit (first column, first row, last column, last row)
+		* \param function Function called with the contents of each cell
+		*/
+		template <typename Cell, typename Function>
+		static void ForEachCell( const std::unordered_map<std::int64_t, Cell> &cells, const glm::ivec4 &range, const Function &function )
+		{
+			const std::uint64_t cellsCovered = std::uint64_t( range.z - range.x + 1 ) * std::uint64_t( range.w - range.y + 1 );
+
+			if ( cellsCovered <= cells.size( ) )
+			{
+				for ( int x = range.x; x <= range.z; x++ )
+				{
+					for ( int y = range.y; y <= range.w; y++ )
+					{
+						const auto cell = cells.find( GetCellKey( x, y ) );
+
+						if ( cells.end( ) != cell )
+						{ function( cell->second ); }
+					}
+				}
+
+				return;
+			}
+
+			// The range covers more cells than are occupied (zoomed out or a large query), cheaper to check each occupied cell against it
+			for ( const auto &cell : cells )
+			{
+				const glm::ivec2 position = GetCellFromKey( cell.first );
+
+				if ( position.x >= range.x && position.x <= range.z && position.y >= range.y && position.y <= range.w )
+				{ function( cell.second ); }
+			}
+		}
+
+	};
+}
@@ -33,6 +33,13 @@ namespace Sonar
          * \brief Run at start of each loop cycle in Game.cpp
         */
 		void ProcessStateChanges( );
+
+        /**
+         * \brief Is a state waiting to be added or removed by the next ProcessStateChanges
+         *
+         * \return Output returns true if the next ProcessStateChanges will change the active state
+        */
+        [[nodiscard]] bool HasPendingChanges( ) const;
         
         /**
          * \brief Get the active state (state ontop of the stack)
@@ -0,0 +1,82 @@
+#pragma once
+
+namespace Sonar
+{
+    class ThreadPool
+    {
+    public:
+        /**
+        * \brief Class constructor
+        *
+        * \param threadCount Number of worker threads to start
+        */
+        ThreadPool( const unsigned int &threadCount );
+
+        /**
+        * \brief Class destructor, waits for queued tasks to finish
+        */
+        ~ThreadPool( );
+
+        /**
+        * \brief Queue a task to be run on a worker thread
+        *
+        * \param task Function to be run
+        *
+        * \return Output returns a future holding the task's result
+        */
+        template<typename Function>
+        [[nodiscard]] std::future<std::invoke_result_t<Function>> Enqueue( Function task )
+        {
+            auto packagedTask = std::make_shared<std::packaged_task<std::invoke_result_t<Function>( )>>( std::move( task ) );
+            auto future = packagedTask->get_future( );
+
+            {
+                std::lock_guard<std::mutex> lock( _mutex );
+                _tasks.push( [packagedTask]( ) { ( *packagedTask )( ); } );
+            }
+
+            _condition.notify_one( );
+
+            return future;
+        }
+
+        /**
+        * \brief Get the number of worker threads
+        *
+        * \return Output returns the number of threads
+        */
+        [[nodiscard]] unsigned int GetThreadCount( ) const;
+
+    private:
+        /**
+        * \brief Loop run by each worker thread
+        */
+        void Work( );
+
+        /**
+        * \brief Worker threads
+        */
+        std::vector<std::thread> _workers;
+
+        /**
+        * \brief Tasks waiting for a worker
+        */
+        std::queue<std::function<void( )>> _tasks;
+
+        /**
+        * \brief Guards the task queue
+        */
+        std::mutex _mutex;
+
+        /**
+        * \brief Wakes workers when a task is queued
+        */
+        std::condition_variable _condition;
+
+        /**
+        * \brief Are the workers shutting down
+        */
+        bool _isStopping;
+
+    };
+}
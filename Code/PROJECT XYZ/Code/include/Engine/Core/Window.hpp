@@ -130,6 +130,43 @@ namespace Sonar
 		*/
 		void Setup( const std::string &title, const Style &style, const ContextSettings &contextSettings = ContextSettings( ) );
 
+		/**
+		* \brief Setup without a window, for running on machines with no display (CI, benchmarks)
+		*
+		* \param width Width of the offscreen target
+		* \param height Height of the offscreen target
+		* \param isRendered Whether or not frames are drawn to an offscreen texture (textures still need an OpenGL context, e.g. a virtual display on Linux servers)
+		*/
+		void SetupHeadless( const unsigned int &width, const unsigned int &height, const bool &isRendered = true );
+
+		/**
+		* \brief Is the window headless
+		*
+		* \return Output returns true if there is no real window and false otherwise
+		*/
+		[[nodiscard]] bool IsHeadless( ) const;
+
+		/**
+		* \brief Is anything drawn, false for a headless window without an offscreen target
+		*
+		* \return Output returns true if frames are rendered and false otherwise
+		*/
+		[[nodiscard]] bool IsRendered( ) const;
+
+		/**
+		* \brief Get the target frames are drawn to, the window or the offscreen texture when headless
+		*
+		* \return Output returns the render target
+		*/
+		[[nodiscard]] sf::RenderTarget &GetRenderTarget( );
+
+		/**
+		* \brief Get the offscreen texture of a headless window (e.g. to save the last frame)
+		*
+		* \return Output returns the offscreen texture
+		*/
+		[[nodiscard]] const sf::Texture &GetOffscreenTexture( ) const;
+
 		/**
 		* \brief Get the underlying SFML Window object
 		*
@@ -306,7 +343,7 @@ namespace Sonar
 		[[nodiscard]] bool HasFocus( ) const;
 
 		/**
-		* \brief Set the Window's current view to display
+		* \brief Set the Window's current view to display (threaded games set views through the render queue, which records them with the frame)
 		*
 		* \param view View to display
 		*/
@@ -365,6 +402,21 @@ namespace Sonar
 		*/
         sf::RenderWindow _window;
 
+		/**
+		* \brief Offscreen target used when headless
+		*/
+		sf::RenderTexture _offscreen;
+
+		/**
+		* \brief Headless state
+		*/
+		bool _isHeadless = false, _isHeadlessOpen = false, _isHeadlessRendered = false;
+
+		/**
+		* \brief Size of the headless window
+		*/
+		glm::uvec2 _headlessSize;
+
 		/**
 		* \brief OpenGL settings
 		*/
@@ -0,0 +1,35 @@
+#pragma once
+
+namespace Sonar
+{
+	/**
+	* \brief Where an entity is in the world
+	*/
+	struct TransformComponent
+	{
+		glm::vec2 _position{ 0, 0 };
+		float _rotation = 0; // Degrees clockwise
+		glm::vec2 _scale{ 1, 1 };
+	};
+
+	/**
+	* \brief How fast an entity moves, applied by PhysicsSystem::Integrate (entities with a body are moved by Box2D instead)
+	*/
+	struct VelocityComponent
+	{
+		glm::vec2 _velocity{ 0, 0 }; // Pixels per second
+		float _angularVelocity = 0; // Degrees per second
+	};
+
+	/**
+	* \brief Textured quad drawn at an entity's transform by the render system
+	*/
+	struct SpriteComponent
+	{
+		const sf::Texture *_texture = nullptr; // Owned elsewhere (usually a Texture), must outlive the component
+		glm::ivec4 _textureRect{ 0, 0, 0, 0 }; // Left, top, width, height in pixels, also the size drawn before scaling
+		glm::vec2 _origin{ 0, 0 }; // Point of the quad placed at the position and rotated around, in pixels from its top left
+		Color _color = Color::White;
+		unsigned char _layer = 0; // Lower layers are drawn first
+	};
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+namespace Sonar
+{
+	/**
+	* \brief Box2D body moving an entity, destroyed along with the component
+	*/
+	struct BodyComponent
+	{
+		/**
+		* \brief Class constructor
+		*
+		* \param physics Physics world the body is in
+		* \param body Body created with Physics::CreateBody
+		*/
+		BodyComponent( Physics *physics = nullptr, b2Body *body = nullptr );
+
+		/**
+		* \brief Class destructor, destroys the body
+		*/
+		~BodyComponent( );
+
+		BodyComponent( const BodyComponent & ) = delete;
+		BodyComponent &operator=( const BodyComponent & ) = delete;
+
+		/**
+		* \brief Take the body of another component
+		*
+		* \param other Component to take from
+		*/
+		BodyComponent( BodyComponent &&other ) noexcept;
+
+		/**
+		* \brief Take the body of another component, destroying this one's
+		*
+		* \param other Component to take from
+		*
+		* \return Output returns this component
+		*/
+		BodyComponent &operator=( BodyComponent &&other ) noexcept;
+
+		Physics *_physics;
+		b2Body *_body;
+		glm::vec2 _previousPosition, _currentPosition; // Pixels, after the last two steps
+		float _previousRotation, _currentRotation; // Degrees, after the last two steps
+	};
+
+	/**
+	* \brief Moves entities, with Box2D bodies (BodyComponent) or with just a velocity (VelocityComponent)
+	*/
+	class PhysicsSystem
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*
+		* \param data Game data object
+		*/
+		PhysicsSystem( GameDataRef data );
+
+		/**
+		* \brief Give an entity a Box2D body at its transform, call from the state's input handling or update so a threaded step isn't running
+		*
+		* \param registry Registry of the entity
+		* \param entity Entity with a TransformComponent
+		* \param bodyDef Body settings, the position and angle are taken from the entity
+		* \param shape Shape of the body's fixture, in meters
+		* \param density Density of the fixture
+		* \param friction Friction of the fixture
+		*
+		* \return Output returns the body, nullptr if the entity has no transform
+		*/
+		b2Body *CreateBody( Registry &registry, const Entity &entity, b2BodyDef bodyDef, const b2Shape &shape, const float &density = 1.0f, const float &friction = 0.7f );
+
+		/**
+		* \brief Read every body's transform after the physics step, call once per fixed step from the state's update
+		*
+		* \param registry Registry to update
+		*/
+		void Update( Registry &registry );
+
+		/**
+		* \brief Move entities with a body between their last two steps, call before drawing
+		*
+		* \param registry Registry to update
+		* \param alpha How far between the last step and the next the frame is (0 to 1)
+		*/
+		void Interpolate( Registry &registry, const float &alpha );
+
+		/**
+		* \brief Move every entity with a velocity, spread across the job system's workers
+		*
+		* \param registry Registry to update
+		* \param dt Delta time
+		*/
+		void Integrate( Registry &registry, const float &dt );
+
+	private:
+		/**
+		* \brief Game data object
+		*/
+		GameDataRef _data;
+
+	};
+}
@@ -0,0 +1,463 @@
+#pragma once
+
+namespace Sonar
+{
+	/**
+	* \brief Set of component types, one bit per type
+	*/
+	typedef std::uint64_t ComponentMask;
+
+	/**
+	* \brief Handle to an entity, stays safe to use after the entity is destroyed (IsAlive returns false)
+	*/
+	struct Entity
+	{
+		std::uint32_t _index = 0xFFFFFFFF;
+		std::uint32_t _generation = 0; // Bumped every time the index is reused
+
+		bool operator==( const Entity &other ) const { return _index == other._index && _generation == other._generation; }
+		bool operator!=( const Entity &other ) const { return !( *this == other ); }
+	};
+
+	template <typename... Components>
+	class ComponentView;
+
+	/**
+	* \brief Stores entities grouped by their exact set of components (archetypes), each archetype keeps one packed array per component so iterating a few components touches only their memory
+	*
+	* Components can be any move constructible type. Adding or removing entities or components while iterating a view is not allowed
+	*/
+	class Registry
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*/
+		Registry( );
+
+		/**
+		* \brief Class destructor, destroys every entity and its components
+		*/
+		~Registry( );
+
+		Registry( const Registry & ) = delete;
+		Registry &operator=( const Registry & ) = delete;
+
+		/**
+		* \brief Create an entity with a set of components
+		*
+		* \param components Components of the entity (each type at most once)
+		*
+		* \return Output returns the entity
+		*/
+		template <typename... Components>
+		Entity CreateEntity( Components... components )
+		{
+			Archetype &archetype = GetArchetype( GetMask<Components...>( ) );
+			const Entity entity = AllocateEntity( );
+			const unsigned int row = AddRow( archetype, entity );
+
+			( new ( archetype.GetPointer( GetComponentType<Components>( ), row ) ) Components( std::move( components ) ), ... );
+
+			return entity;
+		}
+
+		/**
+		* \brief Destroy an entity and its components
+		*
+		* \param entity Entity to destroy
+		*/
+		void DestroyEntity( const Entity &entity );
+
+		/**
+		* \brief Does an entity still exist
+		*
+		* \param entity Entity to check
+		*
+		* \return Output returns true if the entity exists
+		*/
+		[[nodiscard]] bool IsAlive( const Entity &entity ) const;
+
+		/**
+		* \brief Add a component to an entity, moving it to the archetype with the extra component (replaces the component if it already has one)
+		*
+		* \param entity Entity to add to
+		* \param component Component to add
+		*/
+		template <typename Component>
+		void AddComponent( const Entity &entity, Component component )
+		{
+			if ( Component *existing = GetComponent<Component>( entity ) )
+			{
+				*existing = std::move( component );
+
+				return;
+			}
+
+			if ( !IsAlive( entity ) )
+			{ return; }
+
+			const unsigned int type = GetComponentType<Component>( );
+			Archetype &archetype = GetArchetype( _records[entity._index]._archetype->_mask | ( ComponentMask( 1 ) << type ) );
+			const unsigned int row = MoveEntity( entity, archetype );
+
+			new ( archetype.GetPointer( type, row ) ) Component( std::move( component ) );
+		}
+
+		/**
+		* \brief Remove a component from an entity, moving it to the archetype without the component
+		*
+		* \param entity Entity to remove from
+		*/
+		template <typename Component>
+		void RemoveComponent( const Entity &entity )
+		{
+			if ( !HasComponent<Component>( entity ) )
+			{ return; }
+
+			MoveEntity( entity, GetArchetype( _records[entity._index]._archetype->_mask & ~( ComponentMask( 1 ) << GetComponentType<Component>( ) ) ) );
+		}
+
+		/**
+		* \brief Get a component of an entity
+		*
+		* \param entity Entity to get the component of
+		*
+		* \return Output returns the component, nullptr if the entity doesn't have one (only valid until entities or components are next added or removed)
+		*/
+		template <typename Component>
+		[[nodiscard]] Component *GetComponent( const Entity &entity )
+		{
+			if ( !HasComponent<Component>( entity ) )
+			{ return nullptr; }
+
+			const Record &record = _records[entity._index];
+
+			return static_cast<Component *>( record._archetype->GetPointer( GetComponentType<Component>( ), record._row ) );
+		}
+
+		/**
+		* \brief Does an entity have a component
+		*
+		* \param entity Entity to check
+		*
+		* \return Output returns true if the entity exists and has the component
+		*/
+		template <typename Component>
+		[[nodiscard]] bool HasComponent( const Entity &entity ) const
+		{ return IsAlive( entity ) && 0 != ( _records[entity._index]._archetype->_mask & ( ComponentMask( 1 ) << GetComponentType<Component>( ) ) ); }
+
+		/**
+		* \brief Get a view of every entity with a set of components
+		*
+		* \return Output returns the view
+		*/
+		template <typename... Components>
+		[[nodiscard]] ComponentView<Components...> GetView( );
+
+		/**
+		* \brief Destroy every entity
+		*/
+		void Clear( );
+
+		/**
+		* \brief Get the number of entities
+		*
+		* \return Output returns the number of entities
+		*/
+		[[nodiscard]] unsigned int GetEntityCount( ) const;
+
+		/**
+		* \brief Get the number of archetypes (distinct sets of components) created so far
+		*
+		* \return Output returns the number of archetypes
+		*/
+		[[nodiscard]] unsigned int GetArchetypeCount( ) const;
+
+		/**
+		* \brief Get the index of a component type, assigned the first time the type is used (throws std::length_error if ECS_MAX_COMPONENT_TYPES types are already in use)
+		*
+		* \return Output returns the type index
+		*/
+		template <typename Component>
+		[[nodiscard]] static unsigned int GetComponentType( )
+		{
+			static const unsigned int type = RegisterComponentType( sizeof( Component ), alignof( Component ),
+				[]( void *destination, void *source ) { new ( destination ) Component( std::move( *static_cast<Component *>( source ) ) ); },
+				[]( void *component ) { static_cast<Component *>( component )->~Component( ); } );
+
+			return type;
+		}
+
+		/**
+		* \brief Get the mask of a set of component types
+		*
+		* \return Output returns the mask
+		*/
+		template <typename... Components>
+		[[nodiscard]] static ComponentMask GetMask( )
+		{ return ( ComponentMask( 0 ) | ... | ( ComponentMask( 1 ) << GetComponentType<Components>( ) ) ); }
+
+	private:
+		template <typename... Components>
+		friend class ComponentView;
+
+		/**
+		* \brief How to move and destroy a component type without knowing it
+		*/
+		struct ComponentInfo
+		{
+			std::size_t _size;
+			std::size_t _alignment;
+			void ( *_move )( void *destination, void *source ); // Move constructs into uninitialised memory
+			void ( *_destroy )( void *component );
+		};
+
+		/**
+		* \brief Entities sharing the same set of components, one packed array per component
+		*/
+		struct Archetype
+		{
+			ComponentMask _mask;
+			std::vector<unsigned int> _types; // Component type of each array
+			std::array<int, ECS_MAX_COMPONENT_TYPES> _arrayOfType; // Array holding each component type, -1 if the archetype doesn't have it
+			std::vector<unsigned char *> _arrays;
+			std::vector<Entity> _entities; // Entity in each row
+			std::size_t _capacity = 0;
+
+			void *GetPointer( const unsigned int &type, const std::size_t &row ) const;
+
+			template <typename Component>
+			Component *GetArray( ) const { return reinterpret_cast<Component *>( _arrays[_arrayOfType[GetComponentType<Component>( )]] ); }
+		};
+
+		/**
+		* \brief Where an entity's components are stored
+		*/
+		struct Record
+		{
+			Archetype *_archetype = nullptr;
+			unsigned int _row = 0;
+			std::uint32_t _generation = 0;
+		};
+
+		/**
+		* \brief Give a component type its index
+		*
+		* \param size Size of the type
+		* \param alignment Alignment of the type
+		* \param move Function move constructing the type
+		* \param destroy Function destroying the type
+		*
+		* \return Output returns the type index
+		*/
+		static unsigned int RegisterComponentType( const std::size_t &size, const std::size_t &alignment, void ( *move )( void *, void * ), void ( *destroy )( void * ) );
+
+		/**
+		* \brief Get the information of a component type
+		*
+		* \param type Type index
+		*
+		* \return Output returns the type information
+		*/
+		[[nodiscard]] static const ComponentInfo &GetComponentInfo( const unsigned int &type );
+
+		/**
+		* \brief Get the archetype of a set of components, creating it if it doesn't exist yet
+		*
+		* \param mask Component types
+		*
+		* \return Output returns the archetype
+		*/
+		Archetype &GetArchetype( const ComponentMask &mask );
+
+		/**
+		* \brief Get an unused entity, reusing destroyed indices
+		*
+		* \return Output returns the entity
+		*/
+		Entity AllocateEntity( );
+
+		/**
+		* \brief Add a row to an archetype for an entity, its components are left unconstructed
+		*
+		* \param archetype Archetype to add to
+		* \param entity Entity the row is for
+		*
+		* \return Output returns the row
+		*/
+		unsigned int AddRow( Archetype &archetype, const Entity &entity );
+
+		/**
+		* \brief Destroy a row's components and move the last row into its place
+		*
+		* \param archetype Archetype to remove from
+		* \param row Row to remove
+		*/
+		void RemoveRow( Archetype &archetype, const unsigned int &row );
+
+		/**
+		* \brief Move an entity's components to another archetype, components the new archetype doesn't have are destroyed and ones the old archetype didn't have are left unconstructed
+		*
+		* \param entity Entity to move
+		* \param archetype Archetype to move to
+		*
+		* \return Output returns the entity's row in the new archetype
+		*/
+		unsigned int MoveEntity( const Entity &entity, Archetype &archetype );
+
+		/**
+		* \brief Free an archetype's arrays
+		*
+		* \param archetype Archetype to free (must have no rows)
+		*/
+		static void FreeArrays( Archetype &archetype );
+
+		/**
+		* \brief Archetypes by mask, kept in creation order as well so views iterate them the same way every time
+		*/
+		std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> _archetypes;
+		std::vector<Archetype *> _archetypeList;
+
+		/**
+		* \brief Record of every entity index
+		*/
+		std::vector<Record> _records;
+
+		/**
+		* \brief Indices of destroyed entities waiting to be reused
+		*/
+		std::vector<std::uint32_t> _freeIndices;
+
+		/**
+		* \brief Component types registered so far, shared by every registry so a type has the same index everywhere
+		*/
+		static std::array<ComponentInfo, ECS_MAX_COMPONENT_TYPES> _componentInfos;
+		static unsigned int _componentTypeCount;
+		static std::mutex _componentTypeMutex;
+
+		/**
+		* \brief Number of live entities
+		*/
+		unsigned int _entityCount;
+
+	};
+
+	/**
+	* \brief Every entity with a set of components, iterated archetype by archetype over the packed component arrays
+	*/
+	template <typename... Components>
+	class ComponentView
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*
+		* \param registry Registry to view
+		*/
+		ComponentView( Registry &registry ) : _registry( registry ), _mask( Registry::GetMask<Components...>( ) ) { }
+
+		/**
+		* \brief Call a function for every entity in the view
+		*
+		* \param function Function called with a reference to each of the entity's components
+		*/
+		template <typename Function>
+		void ForEach( const Function &function ) const
+		{
+			ForEachArchetype( [&]( Registry::Archetype &archetype )
+			{
+				const auto arrays = std::make_tuple( archetype.GetArray<Components>( )... );
+				const std::size_t count = archetype._entities.size( );
+
+				for ( std::size_t i = 0; i < count; i++ )
+				{ function( std::get<Components *>( arrays )[i]... ); }
+			} );
+		}
+
+		/**
+		* \brief Call a function for every entity in the view
+		*
+		* \param function Function called with the entity and a reference to each of its components
+		*/
+		template <typename Function>
+		void ForEachEntity( const Function &function ) const
+		{
+			ForEachArchetype( [&]( Registry::Archetype &archetype )
+			{
+				const auto arrays = std::make_tuple( archetype.GetArray<Components>( )... );
+				const std::size_t count = archetype._entities.size( );
+
+				for ( std::size_t i = 0; i < count; i++ )
+				{ function( archetype._entities[i], std::get<Components *>( arrays )[i]... ); }
+			} );
+		}
+
+		/**
+		* \brief Call a function for every entity in the view, spread across the job system's workers (the function must be safe to run on several threads at once)
+		*
+		* \param jobs Job system to run on
+		* \param function Function called with a reference to each of the entity's components
+		* \param grainSize Minimum number of entities per job
+		*/
+		template <typename Function>
+		void ParallelForEach( JobSystem &jobs, const Function &function, const unsigned int &grainSize = DEFAULT_ECS_PARALLEL_GRAIN_SIZE ) const
+		{
+			ForEachArchetype( [&]( Registry::Archetype &archetype )
+			{
+				const auto arrays = std::make_tuple( archetype.GetArray<Components>( )... );
+
+				jobs.ParallelFor( static_cast<unsigned int>( archetype._entities.size( ) ), grainSize, [&]( unsigned int begin, unsigned int end )
+				{
+					for ( unsigned int i = begin; i < end; i++ )
+					{ function( std::get<Components *>( arrays )[i]... ); }
+				} );
+			} );
+		}
+
+		/**
+		* \brief Get the number of entities in the view
+		*
+		* \return Output returns the number of entities
+		*/
+		[[nodiscard]] unsigned int GetCount( ) const
+		{
+			unsigned int count = 0;
+
+			ForEachArchetype( [&]( Registry::Archetype &archetype ) { count += static_cast<unsigned int>( archetype._entities.size( ) ); } );
+
+			return count;
+		}
+
+	private:
+		/**
+		* \brief Call a function for every non empty archetype with all of the view's components
+		*
+		* \param function Function called with each archetype
+		*/
+		template <typename Function>
+		void ForEachArchetype( const Function &function ) const
+		{
+			for ( auto archetype : _registry._archetypeList )
+			{
+				if ( _mask == ( archetype->_mask & _mask ) && !archetype->_entities.empty( ) )
+				{ function( *archetype ); }
+			}
+		}
+
+		/**
+		* \brief Registry being viewed
+		*/
+		Registry &_registry;
+
+		/**
+		* \brief Components every entity in the view has
+		*/
+		ComponentMask _mask;
+
+	};
+
+	template <typename... Components>
+	ComponentView<Components...> Registry::GetView( )
+	{ return ComponentView<Components...>( *this ); }
+}
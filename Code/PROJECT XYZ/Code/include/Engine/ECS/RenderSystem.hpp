@@ -0,0 +1,47 @@
+#pragma once
+
+namespace Sonar
+{
+	/**
+	* \brief Draws every entity with a TransformComponent and a SpriteComponent through the render queue, one submission per layer and texture sorted and batched along with every other sprite
+	*/
+	class RenderSystem
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*
+		* \param data Game data object
+		*/
+		RenderSystem( GameDataRef data );
+
+		/**
+		* \brief Build the vertices of every visible entity and submit them, entities outside the view are counted as culled
+		*
+		* \param registry Registry to draw
+		*/
+		void Draw( Registry &registry );
+
+	private:
+		/**
+		* \brief Vertices of every visible entity sharing a layer and texture, kept between frames so they only grow
+		*/
+		struct Batch
+		{
+			std::vector<sf::Vertex> _vertices;
+			unsigned int _vertexCount = 0;
+			const sf::Texture *_texture = nullptr;
+		};
+
+		/**
+		* \brief Game data object
+		*/
+		GameDataRef _data;
+
+		/**
+		* \brief Batches by layer then texture, so iterating them draws lower layers first
+		*/
+		std::map<std::pair<unsigned char, const sf::Texture *>, Batch> _batches;
+
+	};
+}
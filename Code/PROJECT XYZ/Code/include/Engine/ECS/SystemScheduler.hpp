@@ -0,0 +1,114 @@
+#pragma once
+
+namespace Sonar
+{
+	/**
+	* \brief Runs the systems updating a registry each frame, systems that don't touch the same components run at the same time on the job system
+	*
+	* Systems keep the order they were added in wherever they conflict: a system waits for every earlier system that writes a component it reads or writes, or reads a component it writes
+	*/
+	class SystemScheduler
+	{
+	public:
+		/**
+		* \brief Function updating a registry
+		*/
+		typedef std::function<void( Registry &registry, const float &dt )> System;
+
+		/**
+		* \brief Class constructor
+		*
+		* \param data Game data object
+		*/
+		SystemScheduler( GameDataRef data );
+
+		/**
+		* \brief Add a system, run after the systems added before it that it conflicts with
+		*
+		* \param name Name of the system
+		* \param system Function run each frame
+		* \param reads Components the system only reads (Registry::GetMask)
+		* \param writes Components the system writes, adds or removes (Registry::GetMask)
+		* \param isExclusive Does the system need the registry to itself (needed if it creates or destroys entities or adds or removes components)
+		*/
+		void AddSystem( const std::string &name, System system, const ComponentMask &reads, const ComponentMask &writes, const bool &isExclusive = false );
+
+		/**
+		* \brief Remove a system
+		*
+		* \param name Name of the system
+		*/
+		void RemoveSystem( const std::string &name );
+
+		/**
+		* \brief Remove every system
+		*/
+		void Clear( );
+
+		/**
+		* \brief Run every system once, returns when they have all finished
+		*
+		* \param registry Registry the systems update
+		* \param dt Delta time
+		*/
+		void Run( Registry &registry, const float &dt );
+
+		/**
+		* \brief Get the number of systems
+		*
+		* \return Output returns the number of systems
+		*/
+		[[nodiscard]] unsigned int GetSystemCount( ) const;
+
+	private:
+		/**
+		* \brief System and the components it uses
+		*/
+		struct Entry
+		{
+			std::string _name;
+			System _system;
+			ComponentMask _reads;
+			ComponentMask _writes;
+			bool _isExclusive;
+		};
+
+		/**
+		* \brief Can two systems run at the same time
+		*
+		* \param a First system
+		* \param b Second system
+		*
+		* \return Output returns true if they must run one after the other
+		*/
+		[[nodiscard]] static bool Conflicts( const Entry &a, const Entry &b );
+
+		/**
+		* \brief Rebuild the job graph from the systems
+		*/
+		void BuildGraph( );
+
+		/**
+		* \brief Game data object
+		*/
+		GameDataRef _data;
+
+		/**
+		* \brief Systems in the order they were added
+		*/
+		std::vector<Entry> _systems;
+
+		/**
+		* \brief One task per system, rebuilt only when the systems change
+		*/
+		JobGraph _graph;
+		bool _isGraphDirty;
+
+		/**
+		* \brief Registry and delta time of the current run, read by the graph's tasks
+		*/
+		Registry *_registry;
+		float _dt;
+
+	};
+}
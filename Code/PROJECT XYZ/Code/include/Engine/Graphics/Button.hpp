@@ -1584,6 +1584,11 @@ namespace Sonar
         */
         bool _isHoverEnabled, _isClickEnabled;
 
+        /**
+        * \brief Mouse state of the previous update
+        */
+        MOUSE_STATE _lastMouseState;
+
         /**
         * \brief Minimum and maximum size allowed for the button
         */
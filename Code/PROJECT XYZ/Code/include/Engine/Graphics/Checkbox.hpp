@@ -286,5 +286,10 @@ namespace Sonar
         */
         bool _isMouseDown;
 
+        /**
+        * \brief Was the mouse over the component last update
+        */
+        bool _wasMouseOver;
+
     };
 }
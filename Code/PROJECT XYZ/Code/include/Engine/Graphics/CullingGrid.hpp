@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Core/Game.hpp"
+
+namespace Sonar
+{
+	class Drawable;
+
+	/**
+	* \brief Loose grid of drawables, drawing only walks the cells the current view covers
+	*/
+	class CullingGrid
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*
+		* \param data Game data object
+		* \param cellSize Width and height of each cell in world units
+		*/
+		CullingGrid( GameDataRef data, const float &cellSize = DEFAULT_CULLING_GRID_CELL_SIZE );
+
+		/**
+		* \brief Class destructor, detaches every drawable still in the grid
+		*/
+		~CullingGrid( );
+
+		CullingGrid( const CullingGrid & ) = delete;
+		CullingGrid &operator=( const CullingGrid & ) = delete;
+
+		/**
+		* \brief Add a drawable, it keeps its cell up to date as it moves until it is removed or destroyed
+		*
+		* \param drawable Object to add (drawn in the order added)
+		*/
+		void Insert( Drawable &drawable );
+
+		/**
+		* \brief Remove a drawable
+		*
+		* \param drawable Object to remove
+		*/
+		void Remove( Drawable &drawable );
+
+		/**
+		* \brief Move a drawable to the cell its bounds are now centred in, called by the drawable whenever it is transformed
+		*
+		* \param drawable Object that has changed
+		*/
+		void Update( Drawable &drawable );
+
+		/**
+		* \brief Remove every drawable
+		*/
+		void Clear( );
+
+		/**
+		* \brief Draw every drawable inside the current view, objects in cells outside of it are counted as culled without being touched
+		*/
+		void Draw( );
+
+		/**
+		* \brief Get the drawables that may overlap an area
+		*
+		* \param bounds World space area (left, top, width, height)
+		*
+		* \return Output returns the drawables in the cells covering the area, in the order they were added
+		*/
+		[[nodiscard]] std::vector<Drawable *> Query( const glm::vec4 &bounds ) const;
+
+		/**
+		* \brief Get the number of drawables in the grid
+		*
+		* \return Output returns the number of drawables
+		*/
+		[[nodiscard]] unsigned int GetObjectCount( ) const;
+
+	private:
+		/**
+		* \brief Get the key of the cell the centre of an area is in
+		*
+		* \param bounds World space area (left, top, width, height)
+		*
+		* \return Output returns the cell's key
+		*/
+		[[nodiscard]] std::int64_t GetCenterCellKey( const glm::vec4 &bounds ) const;
+
+		/**
+		* \brief Is an area too big to be stored in a cell
+		*
+		* \param bounds World space area (left, top, width, height)
+		*
+		* \return Output returns true if it is wider or taller than a cell
+		*/
+		[[nodiscard]] bool IsOversized( const glm::vec4 &bounds ) const;
+
+		/**
+		* \brief Store a drawable in the cell its centre is in, or in the oversized list
+		*
+		* \param drawable Object to store
+		* \param bounds Object's draw bounds
+		*/
+		void AddToCell( Drawable &drawable, const glm::vec4 &bounds );
+
+		/**
+		* \brief Remove a drawable from the cell or oversized list it is stored in
+		*
+		* \param drawable Object to remove
+		*
+		* \return Output returns true if the drawable was found
+		*/
+		bool RemoveFromCell( Drawable &drawable );
+
+		/**
+		* \brief Game data object
+		*/
+		GameDataRef _data;
+
+		/**
+		* \brief Width and height of each cell
+		*/
+		float _cellSize;
+
+		/**
+		* \brief Drawables by cell, each one is stored once in the cell its centre is in
+		*/
+		std::unordered_map<std::int64_t, std::vector<Drawable *>> _cells;
+
+		/**
+		* \brief Drawables wider or taller than a cell, returned by every query so one large object doesn't widen the search for everything else
+		*/
+		std::vector<Drawable *> _oversized;
+
+		/**
+		* \brief Number of drawables in the grid
+		*/
+		unsigned int _objectCount;
+
+		/**
+		* \brief Order the next drawable is added in
+		*/
+		unsigned int _nextOrder;
+
+	};
+}
@@ -14,6 +14,8 @@
 
 namespace Sonar
 {
+    class CollisionWorld;
+    class CullingGrid;
     class Mouse;
 
     /**
@@ -32,10 +34,38 @@ namespace Sonar
     {
     public:
         /**
-        * \brief Draw object to application window
+        * \brief Draw object to application window (queued in the render queue and batched with similar objects)
         */
         void Draw( );
 
+        /**
+        * \brief Set the render layer, higher layers are drawn on top of lower ones
+        *
+        * \param layer Layer to draw on
+        */
+        void SetLayer( const unsigned char &layer );
+
+        /**
+        * \brief Get the render layer
+        *
+        * \return Output returns the layer
+        */
+        [[nodiscard]] unsigned char GetLayer( ) const;
+
+        /**
+        * \brief Set the depth within the layer, higher depths are drawn on top of lower ones
+        *
+        * \param depth Depth to draw at
+        */
+        void SetDepth( const float &depth );
+
+        /**
+        * \brief Get the depth within the layer
+        *
+        * \return Output returns the depth
+        */
+        [[nodiscard]] float GetDepth( ) const;
+
         /**
         * \brief Set x and y position
         *
@@ -410,6 +440,13 @@ namespace Sonar
         */
         void StopPulse( );
 
+        /**
+        * \brief Is a pulse running (objects that aren't pulsing have nothing to update)
+        *
+        * \return Output returns true if the object is pulsing and false otherwise
+        */
+        [[nodiscard]] bool IsPulsing( ) const;
+
         /**
         * \brief Update the object
         *
@@ -435,7 +472,7 @@ namespace Sonar
         [[nodiscard]] bool IsMouseOver( ) const;
 
         /**
-        * \brief Check if the object has collided with another using bounding box
+        * \brief Check if the object has collided with another using bounding box (use a CollisionWorld to check many objects)
         *
         * \param object The other object to check collision with
         *
@@ -444,7 +481,7 @@ namespace Sonar
         [[nodiscard]] bool BoundingBoxCollision( const Drawable &object ) const;
 
         /**
-        * \brief Check if the object has collided with another using circle collision detection
+        * \brief Check if the object has collided with another using circle collision detection (use a CollisionWorld to check many objects)
         *
         * \param object The other object to check collision with
         *
@@ -459,6 +496,13 @@ namespace Sonar
         */
         [[nodiscard]] glm::vec4 GetGlobalBounds( ) const;
 
+        /**
+        * \brief Get the world space area the object covers when drawn, taking the pivot, scale and rotation into account (used for culling)
+        *
+        * \return Output returns the bounds (left, top, width, height)
+        */
+        [[nodiscard]] glm::vec4 GetDrawBounds( ) const;
+
         /**
         * \brief Get the SFML drawable object
         *
@@ -466,7 +510,28 @@ namespace Sonar
         */
         [[nodiscard]] sf::Drawable *GetSFMLDrawable( ) const;
 
-        void SetupPhysics( );
+        /**
+        * \brief Give the object a box shaped physics body covering its size, from then on the body moves the object (replaces any body it already has)
+        *
+        * \param type Box2D body type
+        * \param density Density of the box
+        * \param friction Friction of the box
+        *
+        * \return Output returns the body
+        */
+        b2Body *SetupPhysics( const b2BodyType &type = b2_dynamicBody, const float &density = 1.0f, const float &friction = 0.7f );
+
+        /**
+        * \brief Remove the object's physics body, the object stays where it was last drawn
+        */
+        void RemovePhysics( );
+
+        /**
+        * \brief Get the object's physics body
+        *
+        * \return Output returns the body, nullptr if the object doesn't have one
+        */
+        [[nodiscard]] b2Body *GetBody( ) const;
 
     protected:
         /**
@@ -476,6 +541,22 @@ namespace Sonar
         */
         Drawable( GameDataRef data );
 
+        /**
+        * \brief Class copy constructor, the copy isn't in the original's culling grid or collision world
+        *
+        * \param drawable Object to copy
+        */
+        Drawable( const Drawable &drawable );
+
+        /**
+        * \brief Copy another object's properties, the object stays in its own culling grid and collision world (if any)
+        *
+        * \param drawable Object to copy
+        *
+        * \return Output returns this object
+        */
+        Drawable &operator=( const Drawable &drawable );
+
         /**
         * \brief Class destructor
         */
@@ -487,9 +568,21 @@ namespace Sonar
         sf::Drawable *_object;
 
         /**
-        * \brief Bounding box relative to the window
+        * \brief Calculate the bounding box relative to the window, children override this with their SFML object's bounds
+        *
+        * \return Output returns the global bounds
+        */
+        [[nodiscard]] virtual sf::FloatRect CalculateGlobalBounds( ) const;
+
+        /**
+        * \brief Bounding box relative to the window, only recalculated when read after it has been marked dirty
         */
-        sf::FloatRect _globalBounds;
+        mutable sf::FloatRect _globalBounds;
+
+        /**
+        * \brief Is the bounding box out of date, set by anything that moves, resizes or transforms the object
+        */
+        mutable bool _isGlobalBoundsDirty = true;
 
         /**
         * \brief Game data object
@@ -497,6 +590,68 @@ namespace Sonar
         GameDataRef _data;
 
     private:
+        friend class CollisionWorld;
+        friend class CullingGrid;
+        friend class Physics;
+
+        /**
+        * \brief Mark the global bounds out of date and let the culling grid the object is in know it has moved or changed size
+        */
+        void OnTransformChanged( );
+
+        /**
+        * \brief Move the object to where its physics body is, called by the physics world before drawing
+        *
+        * \param position World space position of the pivot
+        * \param rotation Rotation in degrees
+        */
+        void SetPhysicsTransform( const glm::vec2 &position, const float &rotation );
+
+        /**
+        * \brief Is a pulse running
+        */
+        bool _isPulsing = false;
+
+        /**
+        * \brief Culling grid the object is in, nullptr if it isn't in one
+        */
+        CullingGrid *_cullingGrid = nullptr;
+
+        /**
+        * \brief Key of the culling grid cell the object is in
+        */
+        std::int64_t _cullingCell = 0;
+
+        /**
+        * \brief Order the object was added to the culling grid
+        */
+        unsigned int _cullingOrder = 0;
+
+        /**
+        * \brief Is the object in the culling grid's oversized list rather than a cell
+        */
+        bool _isCullingOversized = false;
+
+        /**
+        * \brief Collision world the object is in, nullptr if it isn't in one
+        */
+        CollisionWorld *_collisionWorld = nullptr;
+
+        /**
+        * \brief Index of the object's collider in the collision world
+        */
+        unsigned int _colliderIndex = 0;
+
+        /**
+        * \brief Render layer
+        */
+        unsigned char _layer = 0;
+
+        /**
+        * \brief Depth within the render layer
+        */
+        float _depth = 0.0f;
+
         /**
         * \brief Object position vector (x and y)
         */
@@ -567,8 +722,10 @@ namespace Sonar
         */
         Clock _clock;
 
-        b2BodyDef BodyDef;
-        
+        /**
+        * \brief Physics body moving the object, nullptr if it doesn't have one
+        */
+        b2Body *_body = nullptr;
 
     };
 }
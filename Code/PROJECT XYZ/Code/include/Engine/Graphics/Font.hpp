@@ -23,12 +23,21 @@ namespace Sonar
         ~Font( );
 
         /**
-        * \brief Sets the font file
+        * \brief Sets the font file (copies of this font made beforehand keep the previous font)
         *
         * \param filePath Font file path
         */
         void SetFontFile( const std::string &filepath );
 
+        /**
+        * \brief Sets the font from a file already in memory (copies of this font made beforehand keep the previous font)
+        *
+        * \param filePath Font file path the data was read from
+        * \param data Contents of the font file (must stay valid for the lifetime of the font)
+        * \param size Size of the contents in bytes
+        */
+        void SetFontData( const std::string &filepath, const void *data, const std::size_t &size );
+
         /**
         * \brief Gets the font's file path
         *
@@ -77,9 +86,9 @@ namespace Sonar
         std::string _filePath;
 
         /**
-        * \brief SFML font object
+        * \brief SFML font object, shared between copies so glyph pages are only built once
         */
-        sf::Font _font;
+        std::shared_ptr<sf::Font> _font;
 
     };
 }
@@ -59,7 +59,7 @@ namespace Sonar
         void SetTheme( const MenuComponent::Theme &theme );
 
         /**
-        * \brief Sets the font file
+        * \brief Sets the font file, the font is loaded once through the asset manager and shared by every label using the same file
         *
         * \param filePath Font file path
         */
@@ -338,7 +338,7 @@ namespace Sonar
 		void SetText( const std::string &string );
 
         /**
-        * \brief Set the label's font
+        * \brief Set the label's font (the glyphs are shared with the given font rather than copied)
         *
         * \param font Font for the label
         */
@@ -448,6 +448,13 @@ namespace Sonar
         [[nodiscard]] unsigned int GetStringLength( ) const;
 
     private:
+        /**
+        * \brief Calculate the global bounds from the SFML text, only called when they are read after changing
+        *
+        * \return Output returns the global bounds
+        */
+        [[nodiscard]] sf::FloatRect CalculateGlobalBounds( ) const override;
+
         /**
         * \brief Initialize the class (used to abstract common code from all constructors)
         *
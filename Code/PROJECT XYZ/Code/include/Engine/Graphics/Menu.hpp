@@ -90,7 +90,34 @@ namespace Sonar
         */
         [[nodiscard]] const MenuComponent::Theme &GetTheme( ) const;
 
+        /**
+        * \brief Draw the components into a texture that is only redrawn when one of them changes, the menu is then drawn as a single quad
+        */
+        void EnableCaching( );
+
+        /**
+        * \brief Draw the components directly every frame
+        */
+        void DisableCaching( );
+
+        /**
+        * \brief Get the caching status
+        *
+        * \return Output returns true if caching is enabled
+        */
+        [[nodiscard]] const bool &IsCachingEnabled( ) const;
+
+        /**
+        * \brief Force the cache to be redrawn, needed after moving or restyling a component directly as only hover, click, selection, value and text changes are reported by the components
+        */
+        void Invalidate( );
+
     private:
+        /**
+        * \brief Redraw the components into the cache
+        */
+        void RedrawCache( );
+
         /**
         * \brief Game data object
         */
@@ -106,5 +133,30 @@ namespace Sonar
         */
         MenuComponent::Theme _theme;
 
+        /**
+        * \brief Is the menu drawn from the cache
+        */
+        bool _isCachingEnabled;
+
+        /**
+        * \brief Does the cache need redrawing regardless of the components
+        */
+        bool _isCacheDirty;
+
+        /**
+        * \brief Texture the components are drawn into
+        */
+        sf::RenderTexture _cache;
+
+        /**
+        * \brief Quad covering the view the cache is drawn with
+        */
+        sf::Sprite _cacheSprite;
+
+        /**
+        * \brief View the cache was last drawn with
+        */
+        sf::View _cacheView;
+
     };
 }
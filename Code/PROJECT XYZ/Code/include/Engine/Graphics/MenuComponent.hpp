@@ -54,8 +54,30 @@ namespace Sonar
         * \brief Set theme method to be overriden in child classes
         */
         virtual void SetTheme( const MenuComponent::Theme &theme ) = 0;
+
+        /**
+        * \brief Has the component's appearance changed (hover, click, selection, value or text) since the change was last cleared
+        *
+        * \return Output returns true if the component needs redrawing
+        */
+        [[nodiscard]] virtual bool HasVisualChanged( ) const;
+
+        /**
+        * \brief Clear the visual change once the component has been redrawn
+        */
+        virtual void ClearVisualChange( );
     
     protected:
+        /**
+        * \brief Flag the component as needing to be redrawn, called by child classes when their appearance changes
+        */
+        void ReportVisualChange( );
+
+    private:
+        /**
+        * \brief Has the component changed since it was last drawn
+        */
+        bool _hasVisualChanged = true;
 
     };
 }
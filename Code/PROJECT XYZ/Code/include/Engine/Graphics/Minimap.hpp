@@ -26,9 +26,11 @@ namespace Sonar
         */
         struct ObjectProperty
         {
-            std::shared_ptr<Circle> _shape;
-            std::string _type;
+            unsigned int _id;
+            unsigned int _typeIndex; // Index into the type visibility bitmask
             glm::vec2 _position;
+            float _radius;
+            sf::Color _color;
             bool _isShowing;
         };
 
@@ -257,6 +259,25 @@ namespace Sonar
         */
         [[nodiscard]] float GetScale( ) const;
 
+        /**
+        * \brief Draw the markers into a texture that is only redrawn a set number of times per second
+        *
+        * \param refreshRate Number of times per second the texture is redrawn
+        */
+        void EnableCaching( const float &refreshRate = DEFAULT_MINIMAP_CACHE_REFRESH_RATE );
+
+        /**
+        * \brief Redraw the markers every frame
+        */
+        void DisableCaching( );
+
+        /**
+        * \brief Get the caching status
+        *
+        * \return Output returns true if caching is enabled
+        */
+        [[nodiscard]] const bool &IsCachingEnabled( ) const;
+
         /**
         * \brief Get the local bounds (for the background)
         *
@@ -470,24 +491,58 @@ namespace Sonar
 
     private:
         /**
-        * \brief Is point within specified range range
+        * \brief Does the object exist
         *
-        * \param point Point to check within range
-        * \param start Start of the range
-        * \param end End of the range
+        * \param id ID of the object
         *
-        * \return Output returns the true if the point is within the range and false if it is not
+        * \return Output returns true if the object exists and false if it does not
         */
-        [[nodiscard]] bool IsPointWithinRange( const float &point, const float &start, const float &end ) const;
+        [[nodiscard]] bool DoesObjectExist( const unsigned int &id ) const;
 
         /**
-        * \brief Does the object exist
+        * \brief Get the index of a type, the type is given the next free index if it hasn't been seen before
         *
-        * \param id ID of the object
+        * \param type Type of object
         *
-        * \return Output returns true if the object exists and false if it does not
+        * \return Output returns the type's index
+        */
+        unsigned int GetTypeIndex( const std::string &type );
+
+        /**
+        * \brief Get the index of a type without adding it
+        *
+        * \param type Type of object
+        * \param index Index of the type
+        *
+        * \return Output returns true if the type has been seen before
+        */
+        [[nodiscard]] bool FindTypeIndex( const std::string &type, unsigned int &index ) const;
+
+        /**
+        * \brief Is a type hidden
+        *
+        * \param typeIndex Index of the type
+        *
+        * \return Output returns true if objects of the type aren't drawn
+        */
+        [[nodiscard]] bool IsTypeHidden( const unsigned int &typeIndex ) const;
+
+        /**
+        * \brief Remove the object at an index by moving the last object into its place
+        *
+        * \param index Index of the object in the object array
         */
-        [[nodiscard]] bool DoesObjectExist( const unsigned int &id );
+        void RemoveObjectAtIndex( const unsigned int &index );
+
+        /**
+        * \brief Write a marker for every visible object that fits inside the minimap into the vertex array
+        */
+        void BuildMarkers( );
+
+        /**
+        * \brief Redraw the markers into the cache
+        */
+        void RedrawCache( );
 
         /**
         * \brief Game data object
@@ -505,14 +560,59 @@ namespace Sonar
         glm::vec2 _mapSize;
 
         /**
-        * \brief Objects to be displayed on the minimap
+        * \brief Objects to be displayed on the minimap, packed so drawing walks a flat array
+        */
+        std::vector<ObjectProperty> _objects;
+
+        /**
+        * \brief Index of each object in the object array by ID, INVALID_OBJECT_INDEX for removed objects
+        */
+        std::vector<unsigned int> _objectIndices;
+
+        /**
+        * \brief Index of every type seen so far
+        */
+        std::unordered_map<std::string, unsigned int> _typeIndices;
+
+        /**
+        * \brief Bit per type index, set for types that won't be drawn but aren't removed
+        */
+        std::vector<std::uint64_t> _hiddenTypes;
+
+        /**
+        * \brief Triangles of every marker drawn
+        */
+        sf::VertexArray _markers;
+
+        /**
+        * \brief Offsets of a marker's outline points from its centre for a radius of 1
+        */
+        std::vector<sf::Vector2f> _markerPoints;
+
+        /**
+        * \brief Is the minimap drawn from the cache
+        */
+        bool _isCachingEnabled;
+
+        /**
+        * \brief Time between cache redraws and the time since the last one
+        */
+        float _cacheInterval, _cacheTimer;
+
+        /**
+        * \brief Does the cache need redrawing
+        */
+        bool _isCacheDirty;
+
+        /**
+        * \brief Texture the markers are drawn into
         */
-        std::unordered_map<unsigned int, ObjectProperty> _objects;
+        sf::RenderTexture _cache;
 
         /**
-        * \brief The type of objects that won't be drawn but aren't removed
+        * \brief Quad the cache is drawn with
         */
-        std::vector<std::string> _typesToHide;
+        sf::Sprite _cacheSprite;
 
     };
 }
@@ -48,6 +48,14 @@ namespace Sonar
         */
 		void AddLayer( const std::vector<std::string> &backgrounds );
 
+        /**
+        * \brief Add a layer drawn as a single quad filled with a repeating texture, scrolling only moves the texture
+        *
+        * \param filepath File path of the texture
+        * \param size Width and height of the layer, zero to cover the window
+        */
+		void AddRepeatedLayer( const std::string &filepath, const glm::vec2 &size = glm::vec2( 0, 0 ) );
+
         /**
         * \brief Delete a layer
         *
@@ -0,0 +1,297 @@
+#pragma once
+
+#include "Core/Game.hpp"
+
+namespace Sonar
+{
+	/**
+	* \brief Emits particles into a fixed size pool, particles are stored as separate arrays per attribute so they can be updated four at a time and are drawn with a single draw call
+	*/
+	class ParticleEmitter
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*
+		* \param data Game data object
+		* \param capacity Maximum number of live particles, emitting when full does nothing
+		*/
+		ParticleEmitter( GameDataRef data, const unsigned int &capacity = DEFAULT_PARTICLE_EMITTER_CAPACITY );
+
+		/**
+		* \brief Class destructor
+		*/
+		~ParticleEmitter( );
+
+		/**
+		* \brief Emit particles at the emission rate, move every particle and remove the ones that have expired
+		*
+		* \param dt Delta time (difference between frames)
+		*/
+		void Update( const float &dt );
+
+		/**
+		* \brief Draw every particle
+		*/
+		void Draw( );
+
+		/**
+		* \brief Emit particles straight away
+		*
+		* \param count Number of particles to emit
+		*/
+		void Emit( const unsigned int &count );
+
+		/**
+		* \brief Remove every particle
+		*/
+		void Clear( );
+
+		/**
+		* \brief Set the maximum number of live particles, particles past the new capacity are removed
+		*
+		* \param capacity Maximum number of particles
+		*/
+		void SetCapacity( const unsigned int &capacity );
+
+		/**
+		* \brief Get the maximum number of live particles
+		*
+		* \return Output returns the capacity
+		*/
+		[[nodiscard]] unsigned int GetCapacity( ) const;
+
+		/**
+		* \brief Get the number of live particles
+		*
+		* \return Output returns the number of particles
+		*/
+		[[nodiscard]] unsigned int GetParticleCount( ) const;
+
+		/**
+		* \brief Set the number of particles emitted per second by Update
+		*
+		* \param rate Particles per second (0 only emits with Emit)
+		*/
+		void SetEmissionRate( const float &rate );
+
+		/**
+		* \brief Get the number of particles emitted per second
+		*
+		* \return Output returns the emission rate
+		*/
+		[[nodiscard]] const float &GetEmissionRate( ) const;
+
+		/**
+		* \brief Set the position particles are emitted from
+		*
+		* \param position World space position
+		*/
+		void SetPosition( const glm::vec2 &position );
+
+		/**
+		* \brief Set the position particles are emitted from
+		*
+		* \param x X position
+		* \param y Y position
+		*/
+		void SetPosition( const float &x, const float &y );
+
+		/**
+		* \brief Get the position particles are emitted from
+		*
+		* \return Output returns the position
+		*/
+		[[nodiscard]] const glm::vec2 &GetPosition( ) const;
+
+		/**
+		* \brief Set the direction particles are emitted in
+		*
+		* \param direction Direction in degrees (0 is to the right, 90 is down)
+		* \param spread Width of the cone around the direction in degrees (360 emits in every direction)
+		*/
+		void SetDirection( const float &direction, const float &spread );
+
+		/**
+		* \brief Set the speed range of new particles, each particle picks a random speed within it
+		*
+		* \param minimum Minimum speed in world units per second
+		* \param maximum Maximum speed in world units per second
+		*/
+		void SetSpeed( const float &minimum, const float &maximum );
+
+		/**
+		* \brief Set the lifetime range of new particles, each particle picks a random lifetime within it
+		*
+		* \param minimum Minimum lifetime in seconds
+		* \param maximum Maximum lifetime in seconds
+		*/
+		void SetLifetime( const float &minimum, const float &maximum );
+
+		/**
+		* \brief Set the acceleration applied to every particle
+		*
+		* \param gravity Acceleration in world units per second squared
+		*/
+		void SetGravity( const glm::vec2 &gravity );
+
+		/**
+		* \brief Set the size of the particles, interpolated over each particle's life
+		*
+		* \param start Width and height when emitted
+		* \param end Width and height when expiring
+		*/
+		void SetSize( const float &start, const float &end );
+
+		/**
+		* \brief Set the color of the particles, interpolated over each particle's life
+		*
+		* \param start Color when emitted
+		* \param end Color when expiring
+		*/
+		void SetColor( const Color &start, const Color &end );
+
+		/**
+		* \brief Set the texture drawn on each particle
+		*
+		* \param filepath File path (or atlas name) of the texture
+		*/
+		void SetTexture( const std::string &filepath );
+
+		/**
+		* \brief Set the texture drawn on each particle
+		*
+		* \param texture Texture object
+		*/
+		void SetTexture( std::shared_ptr<Texture> texture );
+
+		/**
+		* \brief Set the texture drawn on each particle
+		*
+		* \param region Texture atlas region
+		*/
+		void SetTexture( const TextureAtlas::Region &region );
+
+		/**
+		* \brief Draw particles as plain squares
+		*/
+		void RemoveTexture( );
+
+	private:
+		/**
+		* \brief Vertices of every particle, submitted to the render queue as triangles
+		*/
+		struct Vertices
+		{
+			std::vector<sf::Vertex> _vertices;
+			unsigned int _vertexCount = 0;
+			const sf::Texture *_texture = nullptr;
+		};
+
+		/**
+		* \brief Move every particle and age it
+		*
+		* \param dt Delta time (difference between frames)
+		*/
+		void Integrate( const float &dt );
+
+		/**
+		* \brief Remove expired particles by moving the last particle into their place
+		*/
+		void RemoveExpired( );
+
+		/**
+		* \brief Write the quads of every particle into the vertex buffer
+		*/
+		void BuildVertices( );
+
+		/**
+		* \brief Get a random number
+		*
+		* \param minimum Lowest number returned
+		* \param maximum Highest number returned
+		*
+		* \return Output returns a number between the minimum and maximum
+		*/
+		float Random( const float &minimum, const float &maximum );
+
+		/**
+		* \brief Game data object
+		*/
+		GameDataRef _data;
+
+		/**
+		* \brief Particle attributes, one array each so the update can load four particles at once
+		*/
+		std::vector<float> _positionX, _positionY;
+		std::vector<float> _velocityX, _velocityY;
+		std::vector<float> _age, _inverseLifetime;
+
+		/**
+		* \brief Number of live particles, they are packed at the start of the arrays
+		*/
+		unsigned int _count;
+
+		/**
+		* \brief Maximum number of live particles
+		*/
+		unsigned int _capacity;
+
+		/**
+		* \brief Vertex buffer, allocated for the full capacity up front
+		*/
+		Vertices _vertices;
+
+		/**
+		* \brief Texture drawn on each particle and the part of it used
+		*/
+		std::shared_ptr<Texture> _texture;
+		glm::ivec4 _textureRect;
+
+		/**
+		* \brief Particles per second and the fraction of a particle left over from the last update
+		*/
+		float _emissionRate, _emissionAccumulator;
+
+		/**
+		* \brief Emission position
+		*/
+		glm::vec2 _position;
+
+		/**
+		* \brief Emission direction and spread in degrees
+		*/
+		float _direction, _spread;
+
+		/**
+		* \brief Speed range
+		*/
+		float _minimumSpeed, _maximumSpeed;
+
+		/**
+		* \brief Lifetime range
+		*/
+		float _minimumLifetime, _maximumLifetime;
+
+		/**
+		* \brief Acceleration applied to every particle
+		*/
+		glm::vec2 _gravity;
+
+		/**
+		* \brief Size at the start and end of a particle's life
+		*/
+		float _startSize, _endSize;
+
+		/**
+		* \brief Color at the start and end of a particle's life
+		*/
+		Color _startColor, _endColor;
+
+		/**
+		* \brief State of the random number generator
+		*/
+		std::uint32_t _randomState;
+
+	};
+}
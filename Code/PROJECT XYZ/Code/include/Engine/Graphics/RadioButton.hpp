@@ -308,6 +308,11 @@ namespace Sonar
         */
         bool _isMouseDown;
 
+        /**
+        * \brief Was the mouse over the component last update
+        */
+        bool _wasMouseOver;
+
         /**
         * \brief The time the radio button was selected
         */
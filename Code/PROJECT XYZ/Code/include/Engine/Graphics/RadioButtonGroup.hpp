@@ -83,6 +83,18 @@ namespace Sonar
         */
         void SetTheme( const MenuComponent::Theme &theme );
 
+        /**
+        * \brief Has the group or any of its radio buttons changed since the change was last cleared
+        *
+        * \return Output returns true if the group needs redrawing
+        */
+        [[nodiscard]] bool HasVisualChanged( ) const;
+
+        /**
+        * \brief Clear the visual change of the group and its radio buttons
+        */
+        void ClearVisualChange( );
+
     private:
         /**
         * \brief Game data object
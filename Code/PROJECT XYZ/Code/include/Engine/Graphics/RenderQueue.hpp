@@ -0,0 +1,477 @@
+#pragma once
+
+namespace Sonar
+{
+	class RenderQueue
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*/
+		RenderQueue( );
+
+		/**
+		* \brief Class destructor
+		*/
+		~RenderQueue( );
+
+		/**
+		* \brief Set the target the queue is flushed to
+		*
+		* \param target Render target to draw to
+		*/
+		void SetTarget( sf::RenderTarget *target );
+
+		/**
+		* \brief Set the view the target is drawn with, anything already queued is flushed with the previous view
+		*
+		* \param view View to draw with
+		*/
+		void SetView( const sf::View &view );
+
+		/**
+		* \brief Go back to drawing the target with its default view
+		*/
+		void SetDefaultView( );
+
+		/**
+		* \brief Get the view the target is drawn with (the recorded view while snapshots are recorded for it)
+		*
+		* \return Output returns the view
+		*/
+		[[nodiscard]] const sf::View &GetView( ) const;
+
+		/**
+		* \brief Submit an object to be drawn this frame on the default layer and depth, consecutive submissions sharing a texture and blend mode are merged into a single draw call
+		*
+		* \param drawable SFML object to be drawn (sprites and shapes are batched, text is copied and drawn on its own, anything else is drawn on its own and must stay alive and unchanged until the queue is flushed, and is skipped while recording a snapshot)
+		* \param blendMode Blend mode to draw the object with
+		*/
+		void Submit( const sf::Drawable &drawable, const sf::BlendMode &blendMode = sf::BlendAlpha );
+
+		/**
+		* \brief Submit an object to be drawn this frame, when sorting is enabled submissions are drawn by layer and then depth when the queue is flushed
+		*
+		* \param drawable SFML object to be drawn (sprites and shapes are batched, text is copied and drawn on its own, anything else is drawn on its own and must stay alive and unchanged until the queue is flushed, and is skipped while recording a snapshot)
+		* \param layer Layer to draw on, higher layers are drawn on top
+		* \param depth Depth within the layer, higher depths are drawn on top
+		* \param blendMode Blend mode to draw the object with
+		*/
+		void Submit( const sf::Drawable &drawable, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode = sf::BlendAlpha );
+
+		/**
+		* \brief Submit triangles to be drawn this frame, they are copied and batched with sprites and shapes sharing their texture and blend mode
+		*
+		* \param vertices Vertices, three per triangle
+		* \param vertexCount Number of vertices
+		* \param texture Texture of the triangles (nullptr for none)
+		* \param layer Layer to draw on, higher layers are drawn on top
+		* \param depth Depth within the layer, higher depths are drawn on top
+		* \param blendMode Blend mode to draw the triangles with
+		* \param transform Transform applied to the vertices as they are copied (identity for world space vertices)
+		*/
+		void SubmitTriangles( const sf::Vertex *vertices, const std::size_t &vertexCount, const sf::Texture *texture, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode = sf::BlendAlpha, const sf::Transform &transform = sf::Transform::Identity );
+
+		/**
+		* \brief Get the world space area the target's current view covers (the bounding box when the view is rotated)
+		*
+		* \return Output returns the view bounds (left, top, width, height)
+		*/
+		[[nodiscard]] glm::vec4 GetViewBounds( ) const;
+
+		/**
+		* \brief Check if an area overlaps the current view, areas that don't are counted as culled
+		*
+		* \param bounds World space bounds (left, top, width, height)
+		*
+		* \return Output returns true if the area is visible and false otherwise
+		*/
+		bool IsVisible( const glm::vec4 &bounds );
+
+		/**
+		* \brief Count objects culled without being tested individually (e.g. skipped by a spatial index)
+		*
+		* \param count Number of objects culled
+		*/
+		void AddCulled( const unsigned int &count );
+
+		/**
+		* \brief Draw every queued batch to the target and empty the queue
+		*/
+		void Flush( );
+
+		/**
+		* \brief Store the statistics for the frame that has just been displayed and reset the counters
+		*/
+		void EndFrame( );
+
+		/**
+		* \brief Record what is flushed to the current target into a snapshot instead of drawing it, so one thread can build frames while another draws them (flushes to other targets are still drawn straight away)
+		*/
+		void EnableSnapshots( );
+
+		/**
+		* \brief Flush and hand the recorded snapshot to the drawing thread, replacing a published one it hasn't taken yet
+		*/
+		void PublishSnapshot( );
+
+		/**
+		* \brief Draw the newest published snapshot to its target, drawing the last one again if nothing newer has been published (textures it uses must stay alive until it is replaced or discarded)
+		*/
+		void DrawSnapshot( );
+
+		/**
+		* \brief Drop the published snapshots, waiting for one being drawn to finish, so the textures they use can be destroyed
+		*/
+		void DiscardSnapshots( );
+
+		/**
+		* \brief Enable batching
+		*/
+		void EnableBatching( );
+
+		/**
+		* \brief Disable batching, every submission is drawn with its own draw call
+		*/
+		void DisableBatching( );
+
+		/**
+		* \brief Toggle batching
+		*/
+		void ToggleBatching( );
+
+		/**
+		* \brief Is batching enabled
+		*
+		* \return Output returns true if batching is enabled and false otherwise
+		*/
+		[[nodiscard]] bool IsBatchingEnabled( ) const;
+
+		/**
+		* \brief Enable sorting submissions by layer and depth
+		*/
+		void EnableSorting( );
+
+		/**
+		* \brief Disable sorting, submissions are drawn in the order they were made
+		*/
+		void DisableSorting( );
+
+		/**
+		* \brief Toggle sorting
+		*/
+		void ToggleSorting( );
+
+		/**
+		* \brief Is sorting enabled
+		*
+		* \return Output returns true if sorting is enabled and false otherwise
+		*/
+		[[nodiscard]] bool IsSortingEnabled( ) const;
+
+		/**
+		* \brief Enable grouping submissions on the same layer and depth by texture and blend mode, so they batch together regardless of submission order
+		*/
+		void EnableStateSorting( );
+
+		/**
+		* \brief Disable grouping by texture and blend mode, submissions on the same layer and depth keep their submission order
+		*/
+		void DisableStateSorting( );
+
+		/**
+		* \brief Is grouping by texture and blend mode enabled
+		*
+		* \return Output returns true if state sorting is enabled and false otherwise
+		*/
+		[[nodiscard]] bool IsStateSortingEnabled( ) const;
+
+		/**
+		* \brief Get the number of draw calls issued last frame
+		*
+		* \return Output returns the number of batches
+		*/
+		[[nodiscard]] unsigned int GetBatchCount( ) const;
+
+		/**
+		* \brief Get the number of vertices drawn last frame
+		*
+		* \return Output returns the number of vertices
+		*/
+		[[nodiscard]] unsigned int GetVertexCount( ) const;
+
+		/**
+		* \brief Get the number of objects submitted last frame
+		*
+		* \return Output returns the number of submissions
+		*/
+		[[nodiscard]] unsigned int GetSubmissionCount( ) const;
+
+		/**
+		* \brief Get the number of objects culled last frame
+		*
+		* \return Output returns the number of culled objects
+		*/
+		[[nodiscard]] unsigned int GetCulledCount( ) const;
+
+	private:
+		/**
+		* \brief A run of triangles sharing the same render state
+		*/
+		struct Batch
+		{
+			const sf::Texture *_texture;
+			sf::BlendMode _blendMode;
+			sf::VertexArray _vertices;
+		};
+
+		/**
+		* \brief Batches being built for a target and what they have drawn since the last EndFrame, one list per thread that draws
+		*/
+		struct BatchList
+		{
+			std::vector<Batch> _batches; // Kept between frames so the vertex memory is reused
+			unsigned int _used = 0; // Number of batches in use
+			unsigned int _drawCalls = 0, _vertexCount = 0;
+		};
+
+		/**
+		* \brief Geometry staged for the frame, waiting to be sorted and batched
+		*/
+		struct Submission
+		{
+			std::uint64_t _key; // Layer, depth, texture and blend mode packed from most to least significant
+			const sf::Texture *_texture;
+			sf::BlendMode _blendMode;
+			unsigned int _firstVertex; // Range in the staged vertices
+			unsigned int _vertexCount;
+			int _text; // Index of the staged text, -1 for geometry
+			const sf::Drawable *_drawable; // Custom drawable, nullptr for geometry and text
+		};
+
+		/**
+		* \brief Submissions flushed together with the same view
+		*/
+		struct Pass
+		{
+			sf::View _view;
+			std::size_t _firstSubmission;
+			std::size_t _submissionCount;
+		};
+
+		/**
+		* \brief Sorted submissions of a whole frame and everything they draw from, copied so they can be drawn while the next frame is built
+		*/
+		struct Snapshot
+		{
+			std::vector<Pass> _passes;
+			std::vector<Submission> _submissions;
+			std::vector<sf::Vertex> _vertices;
+			std::vector<sf::Text> _texts;
+			unsigned int _batchCount = 0, _vertexCount = 0, _submissionCount = 0, _culledCount = 0; // Counted while it was built
+
+			void Clear( );
+		};
+
+		/**
+		* \brief Is the current target the one snapshots are recorded for
+		*
+		* \return Output returns true if flushes are recorded rather than drawn
+		*/
+		[[nodiscard]] bool IsRecording( ) const;
+
+		/**
+		* \brief Copy the sorted staged submissions into the snapshot being recorded as a pass with the recorded view
+		*/
+		void Record( );
+
+		/**
+		* \brief Batch and draw sorted submissions, text and custom drawables are drawn on their own in between
+		*
+		* \param target Target to draw to (nullptr to only count)
+		* \param submissions First submission
+		* \param count Number of submissions
+		* \param vertices Vertices the submissions index into
+		* \param texts Texts the submissions index into
+		* \param batches Batches to build
+		*/
+		void DrawSubmissions( sf::RenderTarget *target, const Submission *submissions, const std::size_t &count, const std::vector<sf::Vertex> &vertices, const std::vector<sf::Text> &texts, BatchList &batches );
+
+		/**
+		* \brief Pack a sort key, the depth is mapped to an unsigned integer that sorts in the same order as the float
+		*
+		* \param layer Layer of the submission
+		* \param depth Depth of the submission
+		* \param texture Texture of the submission
+		* \param blendMode Blend mode of the submission
+		*
+		* \return Output returns the sort key
+		*/
+		[[nodiscard]] std::uint64_t MakeKey( const unsigned char &layer, const float &depth, const sf::Texture *texture, const sf::BlendMode &blendMode ) const;
+
+		/**
+		* \brief Start a new staged submission, triangles added afterwards belong to it
+		*
+		* \param key Sort key of the submission
+		* \param texture Texture of the submission
+		* \param blendMode Blend mode of the submission
+		*/
+		void Stage( const std::uint64_t &key, const sf::Texture *texture, const sf::BlendMode &blendMode );
+
+		/**
+		* \brief Stable least significant digit radix sort of the staged submissions by key, a byte at a time, skipping bytes every key shares
+		*/
+		void SortSubmissions( );
+
+		/**
+		* \brief Draw every batch built so far
+		*
+		* \param target Target to draw to (nullptr to only empty the list)
+		* \param batches Batches to draw
+		*/
+		void DrawBatches( sf::RenderTarget *target, BatchList &batches );
+
+		/**
+		* \brief Get the batch to append geometry to, starting a new one if the state differs from the last batch
+		*
+		* \param batches Batches being built
+		* \param texture Texture of the geometry
+		* \param blendMode Blend mode of the geometry
+		*
+		* \return Output returns the batch to append to
+		*/
+		[[nodiscard]] Batch &GetBatch( BatchList &batches, const sf::Texture *texture, const sf::BlendMode &blendMode );
+
+		/**
+		* \brief Stage a sprite's quad
+		*
+		* \param sprite Sprite to be added
+		* \param layer Layer of the sprite
+		* \param depth Depth of the sprite
+		* \param blendMode Blend mode to draw the sprite with
+		*/
+		void AddSprite( const sf::Sprite &sprite, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode );
+
+		/**
+		* \brief Stage a shape's fill and outline triangles
+		*
+		* \param shape Shape to be added
+		* \param layer Layer of the shape
+		* \param depth Depth of the shape
+		* \param blendMode Blend mode to draw the shape with
+		*/
+		void AddShape( const sf::Shape &shape, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode );
+
+		/**
+		* \brief Append a single triangle to the last staged submission
+		*
+		* \param a First vertex
+		* \param b Second vertex
+		* \param c Third vertex
+		*/
+		void AddTriangle( const sf::Vertex &a, const sf::Vertex &b, const sf::Vertex &c );
+
+		/**
+		* \brief Get the points of a circle with a radius of 1, built the first time each point count is asked for
+		*
+		* \param pointCount Number of points
+		*
+		* \return Output returns the points, starting at the top and going clockwise
+		*/
+		[[nodiscard]] const std::vector<sf::Vector2f> &GetUnitCircle( const unsigned int &pointCount );
+
+		/**
+		* \brief Get the number of points a circle needs to look round at the size it is drawn on screen
+		*
+		* \param radius Radius of the circle
+		* \param transform Transform of the circle
+		* \param maximum Point count set on the circle, never exceeded
+		*
+		* \return Output returns the number of points to draw
+		*/
+		[[nodiscard]] unsigned int GetCirclePointCount( const float &radius, const sf::Transform &transform, const unsigned int &maximum ) const;
+
+		/**
+		* \brief Target the batches are drawn to
+		*/
+		sf::RenderTarget *_target;
+
+		/**
+		* \brief Batches drawn by Flush, and the ones the published snapshots are drawn with on the drawing thread
+		*/
+		BatchList _batches, _snapshotBatches;
+
+		/**
+		* \brief Is batching enabled, also read by the thread drawing snapshots
+		*/
+		std::atomic<bool> _isBatchingEnabled;
+
+		/**
+		* \brief Are submissions sorted by layer and depth, and by texture and blend mode within them
+		*/
+		bool _isSortingEnabled, _isStateSortingEnabled;
+
+		/**
+		* \brief Submissions staged since the last flush, and the buffer they are sorted through (both kept between frames)
+		*/
+		std::vector<Submission> _submissions, _sortBuffer;
+
+		/**
+		* \brief Vertices of the staged submissions, copied out by the submission rather than kept as pointers so objects can be destroyed before the flush
+		*/
+		std::vector<sf::Vertex> _stagedVertices;
+
+		/**
+		* \brief Text staged for the frame, text keeps its own geometry so it is drawn on its own in sorted order
+		*/
+		std::vector<sf::Text> _stagedTexts;
+
+		/**
+		* \brief Unit circles by point count
+		*/
+		std::vector<std::vector<sf::Vector2f>> _unitCircles;
+
+		/**
+		* \brief Points of the shape being added and its outline, kept between shapes so the memory is reused
+		*/
+		std::vector<sf::Vector2f> _shapePoints;
+		std::vector<sf::Vertex> _outlineRing;
+
+		/**
+		* \brief Are flushes to the snapshot target recorded, and has a custom drawable been skipped while recording
+		*/
+		bool _isSnapshotEnabled, _hasSkippedDrawable;
+
+		/**
+		* \brief Target snapshots are recorded for and the view they are recorded with
+		*/
+		sf::RenderTarget *_snapshotTarget;
+		sf::View _snapshotView;
+
+		/**
+		* \brief Snapshot being recorded, the newest published one and the one being drawn
+		*/
+		Snapshot _recording, _published, _drawing;
+
+		/**
+		* \brief Has a snapshot been published since the drawing thread last took one
+		*/
+		bool _isSnapshotNew;
+
+		/**
+		* \brief Guards the published snapshot, and the one being drawn while it is drawn
+		*/
+		std::mutex _snapshotMutex, _snapshotDrawMutex;
+
+		/**
+		* \brief Counters for the frame being built
+		*/
+		unsigned int _frameSubmissions, _frameCulled;
+
+		/**
+		* \brief Counters for the last displayed frame
+		*/
+		unsigned int _lastBatches, _lastVertices, _lastSubmissions, _lastCulled;
+
+	};
+}
@@ -53,6 +53,29 @@ namespace Sonar
         */
         void SetBackgrounds( const std::vector<std::string> &backgrounds );
 
+        /**
+        * \brief Draw a single quad filled with a repeating texture instead of separate backgrounds, scrolling then only moves the texture (no gaps can open between copies)
+        *
+        * \param filepath File path of the texture (must be a file of its own, atlas regions can't repeat)
+        * \param size Width and height of the quad, zero to cover the window
+        */
+        void SetRepeatedTexture( const std::string &filepath, const glm::vec2 &size = glm::vec2( 0, 0 ) );
+
+        /**
+        * \brief Draw a single quad filled with a repeating texture instead of separate backgrounds, scrolling then only moves the texture (no gaps can open between copies)
+        *
+        * \param texture Texture object (copied, so setting it to repeat doesn't change other users of the same image)
+        * \param size Width and height of the quad, zero to cover the window
+        */
+        void SetRepeatedTexture( std::shared_ptr<Texture> texture, const glm::vec2 &size = glm::vec2( 0, 0 ) );
+
+        /**
+        * \brief Is the background drawn as a single repeating texture
+        *
+        * \return Output returns true if a repeated texture is set
+        */
+        [[nodiscard]] bool IsRepeated( ) const;
+
         /**
         * \brief Update the scrolling backgrounds
         *
@@ -136,11 +159,39 @@ namespace Sonar
         void SetOffset( const float &offsetX, const float &offsetY );
 
     private:
+        /**
+        * \brief Quad filled with the repeated texture, as two triangles
+        */
+        struct RepeatedQuad
+        {
+            sf::Vertex _vertices[6];
+            const sf::Texture *_texture = nullptr;
+        };
+
         /**
         * \brief Set background position
         */
         void SetBackgroundPositions( );
 
+        /**
+        * \brief Move each background sprite and wrap the ones that have left the screen
+        *
+        * \param dt Delta time between frames
+        */
+        void ScrollSprites( const float &dt );
+
+        /**
+        * \brief Move the repeated texture's offset
+        *
+        * \param dt Delta time between frames
+        */
+        void ScrollRepeatedTexture( const float &dt );
+
+        /**
+        * \brief Update the repeated quad's corners and texture coordinates
+        */
+        void UpdateRepeatedQuad( );
+
         /**
         * \brief Game data object
         */
@@ -175,6 +226,26 @@ namespace Sonar
         * \brief Offsets for the backgrounds
         */
         float _offsetX, _offsetY;
+
+        /**
+        * \brief Copy of the texture repeated across the quad, nullptr when drawing separate backgrounds
+        */
+        std::shared_ptr<Texture> _repeatedTexture;
+
+        /**
+        * \brief Size of the repeated quad, zero to cover the window
+        */
+        glm::vec2 _repeatedSize;
+
+        /**
+        * \brief Scroll offset of the repeated texture, kept within one copy of the texture
+        */
+        glm::vec2 _textureOffset;
+
+        /**
+        * \brief Quad drawn in repeated mode
+        */
+        RepeatedQuad _repeatedQuad;
         
     };
 }
@@ -342,6 +342,13 @@ namespace Sonar
         [[nodiscard]] glm::vec4 GetGlobalBounds( ) const;
 
     private:
+        /**
+        * \brief Calculate the global bounds from the SFML shape, only called when they are read after changing
+        *
+        * \return Output returns the global bounds
+        */
+        [[nodiscard]] sf::FloatRect CalculateGlobalBounds( ) const override;
+
         /**
         * \brief Backend SFML shape object
         */
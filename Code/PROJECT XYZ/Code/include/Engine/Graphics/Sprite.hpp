@@ -228,7 +228,7 @@ namespace Sonar
         void Update( const float &dt );
 
         /**
-        * \brief Set the sprite texture from a file
+        * \brief Set the sprite texture from a file, if a texture with this name is in the texture atlas the atlas region is used instead
         *
 		* \param filePath Location of image to be applied
 		* \param resetRect Whether or not the texture rect should be reset (default set to false)
@@ -243,6 +243,13 @@ namespace Sonar
         */
 		void SetTexture( std::shared_ptr<Texture> texture, const bool &resetRect = false );
 
+        /**
+        * \brief Set the sprite texture to a region of the texture atlas
+        *
+        * \param region Atlas region to be applied (the texture rect is set to the region)
+        */
+		void SetTexture( const TextureAtlas::Region &region );
+
         /**
         * \brief Set the sprite rectangle
         *
@@ -289,7 +296,7 @@ namespace Sonar
         [[nodiscard]] glm::vec4 GetGlobalBounds( ) const;
 
         /**
-        * \brief Check for pixel perfect collision (very heavy on the processing)
+        * \brief Check for pixel perfect collision, each texture's solid pixels are cached the first time and only the area where the sprites overlap is tested, a row at a time for unrotated and unscaled sprites
         *
 		* \param object Object to check collision with
 		* \param alphaLimit The threshold at which a pixel becomes "solid". If AlphaLimit is 127, a pixel with alpha value 128 will cause a collision and a pixel with alpha value 126 will not.
@@ -306,6 +313,13 @@ namespace Sonar
         [[nodiscard]] const sf::Sprite &GetSFMLSprite( ) const;
 
     private:
+        /**
+        * \brief Calculate the global bounds from the SFML sprite, only called when they are read after changing
+        *
+        * \return Output returns the global bounds
+        */
+        [[nodiscard]] sf::FloatRect CalculateGlobalBounds( ) const override;
+
         /**
         * \brief Sprite for the class
         */
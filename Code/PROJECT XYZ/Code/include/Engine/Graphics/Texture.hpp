@@ -11,7 +11,7 @@ namespace Sonar
         Texture( );
 
         /**
-        * \brief Class constructor
+        * \brief Class constructor, the image is shared through the texture cache
         *
         * \param filepath File path of the image
         */
@@ -23,19 +23,27 @@ namespace Sonar
         ~Texture( );
 
         /**
-        * \brief Set the texture from an image file
+        * \brief Set the texture from an image file, the image is shared through the texture cache
         *
 		* \param filepath File path of the image
         */
         void SetTexture( const std::string &filepath );
         
         /**
-        * \brief Set the texture from another texture
+        * \brief Share the texture of another texture
         *
         * \param texture Texture object
         */
         void SetTexture( const Texture &texture );
 
+        /**
+        * \brief Set the texture from an image that has already been decoded, the image is shared through the texture cache
+        *
+        * \param filepath File path the image was decoded from
+        * \param image Decoded image
+        */
+        void SetTexture( const std::string &filepath, const sf::Image &image );
+
         /**
         * \brief Get the SFML texture object
         *
@@ -51,7 +59,7 @@ namespace Sonar
         [[nodiscard]] glm::vec2 GetSize( ) const;
 
         /**
-        * \brief Set the repeat status
+        * \brief Set the repeat status (affects every user of the same cached image)
         *
         * \param repeated Does the texture repeat
         */
@@ -64,11 +72,20 @@ namespace Sonar
         */
         [[nodiscard]] bool IsRepeated( ) const;
 
+        /**
+        * \brief Get the solid pixels of the texture for pixel perfect collision, built the first time it is asked for and shared with every user of the same image
+        *
+        * \param alphaLimit Pixels with an alpha above this are solid
+        *
+        * \return Output returns the bitmask
+        */
+        [[nodiscard]] std::shared_ptr<const Bitmask> GetBitmask( const unsigned char &alphaLimit = 0 ) const;
+
     private:
         /**
-        * \brief SFML texture object
+        * \brief SFML texture object, shared with every other user of the same image
         */
-        sf::Texture *_texture;
+        std::shared_ptr<sf::Texture> _texture;
         
     };
 }
@@ -0,0 +1,160 @@
+#pragma once
+
+namespace Sonar
+{
+	class Texture;
+
+	class TextureAtlas
+	{
+	public:
+		/**
+		* \brief Area of an atlas page holding a single image
+		*/
+		struct Region
+		{
+			std::shared_ptr<Texture> _page;
+			unsigned int _pageIndex;
+			glm::ivec4 _rect; // left, top, width, height in pixels
+		};
+
+		/**
+		* \brief Class constructor
+		*
+		* \param pageSize Width and height of each atlas page (clamped to the maximum texture size of the GPU)
+		* \param padding Empty pixels left between packed images to stop neighbouring images bleeding into each other
+		*/
+		TextureAtlas( const unsigned int &pageSize = DEFAULT_TEXTURE_ATLAS_PAGE_SIZE, const unsigned int &padding = DEFAULT_TEXTURE_ATLAS_PADDING );
+
+		/**
+		* \brief Class destructor
+		*/
+		~TextureAtlas( );
+
+		/**
+		* \brief Pack an image into the atlas, a new page is created when the current ones are full
+		*
+		* \param name Name of the region (used to retrieve it)
+		* \param image Image to be packed
+		*
+		* \return Output returns true if the image was packed and false if it is too large for a page
+		*/
+		bool AddImage( const std::string &name, const sf::Image &image );
+
+		/**
+		* \brief Load an image file and pack it into the atlas
+		*
+		* \param name Name of the region (used to retrieve it)
+		* \param filepath File path of the image
+		*
+		* \return Output returns true if the image was loaded and packed
+		*/
+		bool AddImage( const std::string &name, const std::string &filepath );
+
+		/**
+		* \brief Load a prebuilt atlas, the pages are added after any existing pages
+		*
+		* \param filepath File path of the atlas description
+		*
+		* \return Output returns true if the atlas was loaded, false if it couldn't be read or a region was malformed (the valid regions are still added)
+		*
+		* The description is a JSON file, page paths are relative to it:
+		* { "pages": [ "atlas0.png" ], "regions": { "Player": [ 0, 0, 0, 64, 64 ] } }
+		* where every region is [ page, left, top, width, height ]
+		*/
+		bool LoadFromFile( const std::string &filepath );
+
+		/**
+		* \brief Does the atlas have a region with the given name
+		*
+		* \param name Name of the region
+		*
+		* \return Output returns true if the region exists and false otherwise
+		*/
+		[[nodiscard]] bool HasRegion( const std::string &name ) const;
+
+		/**
+		* \brief Get a region
+		*
+		* \param name Name of the region
+		*
+		* \return Output returns the requested region
+		*/
+		[[nodiscard]] const Region &GetRegion( const std::string &name ) const;
+
+		/**
+		* \brief Get the number of pages
+		*
+		* \return Output returns the number of pages
+		*/
+		[[nodiscard]] unsigned int GetPageCount( ) const;
+
+		/**
+		* \brief Get a page
+		*
+		* \param index Index of the page
+		*
+		* \return Output returns the page texture
+		*/
+		[[nodiscard]] std::shared_ptr<Texture> GetPage( const unsigned int &index ) const;
+
+	private:
+		/**
+		* \brief Row of images on a page, images are placed left to right until the row is full
+		*/
+		struct Shelf
+		{
+			unsigned int _top;
+			unsigned int _height;
+			unsigned int _cursor;
+		};
+
+		/**
+		* \brief Atlas page and the space already used on it
+		*/
+		struct Page
+		{
+			std::shared_ptr<Texture> _texture;
+			std::vector<Shelf> _shelves;
+			unsigned int _usedHeight;
+			bool _isPacked; // Prebuilt pages are never packed into
+		};
+
+		/**
+		* \brief Find space for an image on a page
+		*
+		* \param page Page to search
+		* \param width Width of the image
+		* \param height Height of the image
+		* \param position Top left corner of the space found
+		*
+		* \return Output returns true if space was found
+		*/
+		bool Allocate( Page &page, const unsigned int &width, const unsigned int &height, glm::uvec2 &position );
+
+		/**
+		* \brief Add an empty page to pack into
+		*/
+		void AddPage( );
+
+		/**
+		* \brief Size of each page
+		*/
+		unsigned int _pageSize;
+
+		/**
+		* \brief Padding between images
+		*/
+		unsigned int _padding;
+
+		/**
+		* \brief Atlas pages
+		*/
+		std::vector<Page> _pages;
+
+		/**
+		* \brief Regions by name
+		*/
+		std::map<std::string, Region> _regions;
+
+	};
+}
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <Managers/AssetArchive.hpp>
+
+namespace Sonar
+{
+    class TextureCache
+    {
+    public:
+        /**
+        * \brief Get the singleton instance (create one if it hasn't been already)
+        *
+        * \return Output returns the singleton instance
+        */
+        [[nodiscard]] static TextureCache *getInstance( );
+
+        /**
+        * \brief Get the texture for an image file, the file is only decoded and uploaded if no live texture has the same path or contents (files in an added archive are read from it)
+        *
+        * \param filepath File path of the image
+        *
+        * \return Output returns the shared texture (released once every user has let go of it)
+        */
+        [[nodiscard]] std::shared_ptr<sf::Texture> Load( const std::string &filepath );
+
+        /**
+        * \brief Get the texture for an image that has already been decoded, the image is only uploaded if no live texture has the same path
+        *
+        * \param filepath File path the image was decoded from
+        * \param image Decoded image
+        *
+        * \return Output returns the shared texture (released once every user has let go of it)
+        */
+        [[nodiscard]] std::shared_ptr<sf::Texture> Load( const std::string &filepath, const sf::Image &image );
+
+        /**
+        * \brief Get the number of textures currently alive in the cache
+        *
+        * \return Output returns the number of textures
+        */
+        [[nodiscard]] unsigned int GetTextureCount( );
+
+        /**
+        * \brief Read images contained in an archive from it instead of the disk, archives added later override earlier ones
+        *
+        * \param archive Opened archive (must be removed before it is closed)
+        */
+        void AddArchive( AssetArchive *archive );
+
+        /**
+        * \brief Stop reading images from an archive, textures already loaded from it stay valid
+        *
+        * \param archive Archive to remove
+        */
+        void RemoveArchive( AssetArchive *archive );
+
+        /**
+        * \brief Get the solid pixels of a texture, the pixels are only read back from the texture the first time each alpha limit is asked for
+        *
+        * \param texture Texture
+        * \param alphaLimit Pixels with an alpha above this are solid
+        *
+        * \return Output returns the bitmask (released along with the texture)
+        */
+        [[nodiscard]] std::shared_ptr<const Bitmask> GetBitmask( const std::shared_ptr<sf::Texture> &texture, const unsigned char &alphaLimit );
+
+        /**
+        * \brief Decode an image file, using the disk cache of decoded pixels if it is enabled (safe to call from any thread)
+        *
+        * \param filepath File path of the image
+        * \param image Decoded image
+        *
+        * \return Output returns true if the image was decoded
+        */
+        bool DecodeImage( const std::string &filepath, sf::Image &image ) const;
+
+        /**
+        * \brief Enable the disk cache, decoded pixels are stored keyed by source path, modification time and size and read back instead of decoding
+        */
+        void EnableDiskCache( );
+
+        /**
+        * \brief Disable the disk cache
+        */
+        void DisableDiskCache( );
+
+        /**
+        * \brief Is the disk cache enabled
+        *
+        * \return Output returns true if the disk cache is enabled and false otherwise
+        */
+        [[nodiscard]] bool IsDiskCacheEnabled( ) const;
+
+        /**
+        * \brief Set the directory the disk cache is stored in (set before loading any textures)
+        *
+        * \param directory Directory of the disk cache
+        */
+        void SetDiskCacheDirectory( const std::string &directory );
+
+        /**
+        * \brief Get the directory the disk cache is stored in
+        *
+        * \return Output returns the directory
+        */
+        [[nodiscard]] std::string GetDiskCacheDirectory( ) const;
+
+    private:
+        /**
+        * \brief Class constructor
+        */
+        TextureCache( );
+
+        /**
+        * \brief Get the cache key for a file path
+        *
+        * \param filepath File path of the image
+        *
+        * \return Output returns the canonical path (or the path as given if it cannot be resolved)
+        */
+        [[nodiscard]] static std::string GetKey( const std::string &filepath );
+
+        /**
+        * \brief Canonical path, size and modification time of a file, so a file changed on disk is loaded again
+        */
+        typedef std::tuple<std::string, std::uint64_t, std::int64_t> PathKey;
+
+        /**
+        * \brief Get the texture key for a file path, only needs the file's metadata
+        *
+        * \param filepath File path of the image
+        *
+        * \return Output returns the key
+        */
+        [[nodiscard]] static PathKey GetPathKey( const std::string &filepath );
+
+        /**
+        * \brief Get the size and modification time of a file
+        *
+        * \param filepath File path
+        * \param size Size of the file
+        * \param time Modification time of the file
+        *
+        * \return Output returns true if the file exists and false otherwise (size and time are left untouched)
+        */
+        static bool GetFileStamp( const std::string &filepath, std::uint64_t &size, std::int64_t &time );
+
+        /**
+        * \brief Read a whole file
+        *
+        * \param filepath File path
+        *
+        * \return Output returns the bytes of the file, empty if it couldn't be read
+        */
+        [[nodiscard]] static std::vector<char> ReadFile( const std::string &filepath );
+
+        /**
+        * \brief Header of a disk cache file, followed by the RGBA pixels
+        */
+        struct DiskCacheHeader
+        {
+            char _magic[4];
+            std::uint32_t _width;
+            std::uint32_t _height;
+            std::uint32_t _reserved;
+            std::uint64_t _sourceSize;
+            std::int64_t _sourceTime;
+        };
+
+        /**
+        * \brief Hash bytes (FNV-1a)
+        *
+        * \param data Bytes to hash
+        * \param size Number of bytes
+        *
+        * \return Output returns the 64 bit hash
+        */
+        [[nodiscard]] static std::uint64_t Hash( const char *data, const std::size_t &size );
+
+        /**
+        * \brief Get the disk cache file of an image
+        *
+        * \param filepath File path of the image
+        * \param sourceSize Size of the image file
+        * \param sourceTime Modification time of the image file
+        *
+        * \return Output returns the path of the cache file
+        */
+        [[nodiscard]] std::string GetDiskCachePath( const std::string &filepath, const std::uint64_t &sourceSize, const std::int64_t &sourceTime ) const;
+
+        /**
+        * \brief Read decoded pixels from the disk cache
+        *
+        * \param cachePath Path of the cache file
+        * \param sourceSize Size the image file must have
+        * \param sourceTime Modification time the image file must have
+        * \param image Image the pixels are read into
+        *
+        * \return Output returns true if a valid cache file was read
+        */
+        static bool ReadDiskCache( const std::string &cachePath, const std::uint64_t &sourceSize, const std::int64_t &sourceTime, sf::Image &image );
+
+        /**
+        * \brief Write decoded pixels to the disk cache
+        *
+        * \param cachePath Path of the cache file
+        * \param sourceSize Size of the image file
+        * \param sourceTime Modification time of the image file
+        * \param image Decoded image
+        */
+        static void WriteDiskCache( const std::string &cachePath, const std::uint64_t &sourceSize, const std::int64_t &sourceTime, const sf::Image &image );
+
+        /**
+        * \brief Remove entries whose texture has been released
+        */
+        void Prune( );
+
+        /**
+        * \brief Textures by canonical file path, size and modification time
+        */
+        std::map<PathKey, std::weak_ptr<sf::Texture>> _texturesByPath;
+
+        /**
+        * \brief Texture loaded straight from a file, with the file it came from so a possible copy can be compared against it
+        */
+        struct ContentEntry
+        {
+            std::string _filepath;
+            std::weak_ptr<sf::Texture> _texture;
+            std::uint64_t _hash; // Hash of the file, only worked out once another file of the same size is loaded
+            bool _isHashed;
+        };
+
+        /**
+        * \brief Textures by the size of their file, so copies of an image under different paths share a texture
+        */
+        std::multimap<std::uint64_t, ContentEntry> _texturesBySize;
+
+        /**
+        * \brief Bitmask built for a texture and alpha limit, kept until the texture is released
+        */
+        struct BitmaskEntry
+        {
+            std::weak_ptr<sf::Texture> _texture; // Checked before use, a released texture's address can be reused
+            std::shared_ptr<const Bitmask> _bitmask;
+        };
+
+        /**
+        * \brief Bitmasks by texture and alpha limit
+        */
+        std::map<std::pair<const sf::Texture *, unsigned char>, BitmaskEntry> _bitmasks;
+
+        /**
+        * \brief Archives images are read from, searched from the back
+        */
+        std::vector<AssetArchive *> _archives;
+
+        /**
+        * \brief Is the disk cache enabled, atomic as images are decoded on the asset loader threads
+        */
+        std::atomic<bool> _isDiskCacheEnabled;
+
+        /**
+        * \brief Directory of the disk cache, only accessed under its mutex as the loader threads read it while it can be changed
+        */
+        std::string _diskCacheDirectory;
+        mutable std::mutex _diskCacheMutex;
+
+    };
+}
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Core/Game.hpp"
+
+namespace Sonar
+{
+	class MapManager;
+
+	/**
+	* \brief Draws a MapManager's tiles from a texture atlas, the map is split into chunks that are each built into a static vertex array and only rebuilt when a tile inside them changes
+	*/
+	class TileMap
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*
+		* \param data Game data object
+		* \param map Map to draw, tiles changed through it are redrawn automatically
+		* \param tileSize Width and height of each tile in world units
+		* \param chunkSize Width and height of each chunk in tiles
+		*/
+		TileMap( GameDataRef data, MapManager &map, const glm::vec2 &tileSize, const unsigned int &chunkSize = DEFAULT_TILE_MAP_CHUNK_SIZE );
+
+		/**
+		* \brief Class destructor, detaches from the map
+		*/
+		~TileMap( );
+
+		TileMap( const TileMap & ) = delete;
+		TileMap &operator=( const TileMap & ) = delete;
+
+		/**
+		* \brief Draw the chunks inside the current view, chunks outside of it are counted as culled without being touched
+		*/
+		void Draw( );
+
+		/**
+		* \brief Set the texture the tiles are cut from
+		*
+		* \param filepath File path (or atlas name) of the texture
+		*/
+		void SetTexture( const std::string &filepath );
+
+		/**
+		* \brief Set the texture the tiles are cut from
+		*
+		* \param texture Texture object
+		*/
+		void SetTexture( std::shared_ptr<Texture> texture );
+
+		/**
+		* \brief Set the texture the tiles are cut from, tile rectangles are then relative to the region
+		*
+		* \param region Texture atlas region
+		*/
+		void SetTexture( const TextureAtlas::Region &region );
+
+		/**
+		* \brief Get the texture the tiles are cut from
+		*
+		* \return Output returns the texture
+		*/
+		[[nodiscard]] std::shared_ptr<Texture> GetTexture( ) const;
+
+		/**
+		* \brief Set the part of the texture a map value is drawn with, values without one are left empty
+		*
+		* \param value Map value
+		* \param rectangle Texture rectangle (left, top, width, height)
+		*/
+		void SetTile( const char &value, const glm::ivec4 &rectangle );
+
+		/**
+		* \brief Set the part of the texture a map value is drawn with, values without one are left empty
+		*
+		* \param value Map value
+		* \param left Left of the texture rectangle
+		* \param top Top of the texture rectangle
+		* \param width Width of the texture rectangle
+		* \param height Height of the texture rectangle
+		*/
+		void SetTile( const char &value, const int &left, const int &top, const int &width, const int &height );
+
+		/**
+		* \brief Stop drawing a map value
+		*
+		* \param value Map value
+		*/
+		void RemoveTile( const char &value );
+
+		/**
+		* \brief Get the part of the texture a map value is drawn with
+		*
+		* \param value Map value
+		*
+		* \return Output returns the texture rectangle (left, top, width, height), zero sized if the value isn't drawn
+		*/
+		[[nodiscard]] const glm::ivec4 &GetTile( const char &value ) const;
+
+		/**
+		* \brief Set the position of the map's top left corner
+		*
+		* \param position World space position
+		*/
+		void SetPosition( const glm::vec2 &position );
+
+		/**
+		* \brief Set the position of the map's top left corner
+		*
+		* \param x X position
+		* \param y Y position
+		*/
+		void SetPosition( const float &x, const float &y );
+
+		/**
+		* \brief Get the position of the map's top left corner
+		*
+		* \return Output returns the position
+		*/
+		[[nodiscard]] const glm::vec2 &GetPosition( ) const;
+
+		/**
+		* \brief Set the size of each tile
+		*
+		* \param tileSize Width and height of each tile in world units
+		*/
+		void SetTileSize( const glm::vec2 &tileSize );
+
+		/**
+		* \brief Get the size of each tile
+		*
+		* \return Output returns the tile size
+		*/
+		[[nodiscard]] const glm::vec2 &GetTileSize( ) const;
+
+		/**
+		* \brief Get the number of chunks the map is split into
+		*
+		* \return Output returns the number of chunks across and down
+		*/
+		[[nodiscard]] const glm::uvec2 &GetChunkCount( ) const;
+
+		/**
+		* \brief Rebuild every chunk the next time it is drawn
+		*/
+		void Rebuild( );
+
+	private:
+		friend class MapManager;
+
+		/**
+		* \brief Block of tiles submitted as a single run of triangles
+		*/
+		struct Chunk
+		{
+			sf::VertexArray _vertices{ sf::Triangles };
+			const sf::Texture *_texture = nullptr;
+			sf::Transform _transform;
+			bool _isDirty = true;
+		};
+
+		/**
+		* \brief Mark the chunk containing a tile for rebuilding, called by the map when a tile is set
+		*
+		* \param x Tile column
+		* \param y Tile row
+		*/
+		void OnTileChanged( const unsigned int &x, const unsigned int &y );
+
+		/**
+		* \brief Resize the chunks to fit the map and rebuild them all, called by the map when it is filled or loaded
+		*/
+		void OnMapChanged( );
+
+		/**
+		* \brief Build a chunk's vertices from the map
+		*
+		* \param x Chunk column
+		* \param y Chunk row
+		*/
+		void BuildChunk( const unsigned int &x, const unsigned int &y );
+
+		/**
+		* \brief Game data object
+		*/
+		GameDataRef _data;
+
+		/**
+		* \brief Map being drawn, nullptr once the map has been destroyed
+		*/
+		MapManager *_map;
+
+		/**
+		* \brief Texture the tiles are cut from
+		*/
+		std::shared_ptr<Texture> _texture;
+
+		/**
+		* \brief Offset of the texture region inside the texture (non zero for atlas regions)
+		*/
+		glm::ivec2 _textureOffset;
+
+		/**
+		* \brief Texture rectangle of every map value, indexed by the value
+		*/
+		std::array<glm::ivec4, 256> _tiles;
+
+		/**
+		* \brief Position of the map's top left corner
+		*/
+		glm::vec2 _position;
+
+		/**
+		* \brief Width and height of each tile
+		*/
+		glm::vec2 _tileSize;
+
+		/**
+		* \brief Width and height of each chunk in tiles
+		*/
+		unsigned int _chunkSize;
+
+		/**
+		* \brief Number of chunks across and down
+		*/
+		glm::uvec2 _chunkCount;
+
+		/**
+		* \brief Chunks, row by row
+		*/
+		std::vector<Chunk> _chunks;
+
+	};
+}
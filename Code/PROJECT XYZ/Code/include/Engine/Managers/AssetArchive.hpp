@@ -0,0 +1,175 @@
+#pragma once
+
+namespace Sonar
+{
+	class AssetArchive
+	{
+	public:
+		/**
+		 * \brief Bytes of an archive entry
+		*/
+		struct Entry
+		{
+			const void *_data;
+			std::size_t _size;
+		};
+
+		/**
+		 * \brief Class constructor
+		*/
+		AssetArchive( );
+
+		/**
+		 * \brief Class destructor, unmaps the archive
+		*/
+		~AssetArchive( );
+
+		AssetArchive( const AssetArchive & ) = delete;
+		AssetArchive &operator=( const AssetArchive & ) = delete;
+
+		/**
+		 * \brief Pack every file in a directory into an archive, entries are named by their path starting with the directory (e.g. "Resources/arial.ttf")
+		 *
+		 * \param directory Directory to pack
+		 * \param fileName Filepath and filename of the archive to write
+		 * \param compress Whether or not entries are LZ4 compressed (entries that don't shrink are stored as is)
+		 *
+		 * \return Output returns true if the archive was written
+		*/
+		static bool Pack( const std::string &directory, const std::string &fileName, const bool &compress = false );
+
+		/**
+		 * \brief Open an archive by memory mapping it
+		 *
+		 * \param fileName Filepath and filename of the archive
+		 *
+		 * \return Output returns true if the archive was opened
+		*/
+		bool Open( const std::string &fileName );
+
+		/**
+		 * \brief Close the archive, entries retrieved beforehand are no longer valid
+		*/
+		void Close( );
+
+		/**
+		 * \brief Does the archive contain an entry
+		 *
+		 * \param name Logical name of the entry (its path when packed)
+		 *
+		 * \return Output returns true if the entry exists and false otherwise
+		*/
+		[[nodiscard]] bool Contains( const std::string &name ) const;
+
+		/**
+		 * \brief Get the bytes of an entry, uncompressed entries point straight into the mapped file and compressed ones are decompressed once and kept
+		 *
+		 * \param name Logical name of the entry (its path when packed)
+		 * \param entry Bytes of the entry, valid until the archive is closed
+		 *
+		 * \return Output returns true if the entry was found
+		*/
+		bool GetEntry( const std::string &name, Entry &entry );
+
+		/**
+		 * \brief Get the number of entries
+		 *
+		 * \return Output returns the number of entries
+		*/
+		[[nodiscard]] unsigned int GetEntryCount( ) const;
+
+	private:
+		/**
+		 * \brief Archive header, followed by the sorted index, the names and the data
+		*/
+		struct Header
+		{
+			char _magic[4];
+			std::uint32_t _version;
+			std::uint32_t _entryCount;
+			std::uint32_t _reserved;
+		};
+
+		/**
+		 * \brief Index record of an entry, the index is sorted by name so it can be binary searched in place
+		*/
+		struct IndexEntry
+		{
+			std::uint64_t _dataOffset;
+			std::uint64_t _storedSize;
+			std::uint64_t _size;
+			std::uint32_t _nameOffset;
+			std::uint16_t _nameLength;
+			std::uint16_t _flags;
+		};
+
+		/**
+		 * \brief Entry flags
+		*/
+		enum FLAGS
+		{
+			LZ4 = 1 << 0
+		};
+
+		/**
+		 * \brief Normalise a path into an entry name
+		 *
+		 * \param path Path to normalise
+		 *
+		 * \return Output returns the entry name
+		*/
+		[[nodiscard]] static std::string GetEntryName( const std::string &path );
+
+		/**
+		 * \brief Find the index record of an entry
+		 *
+		 * \param name Entry name
+		 *
+		 * \return Output returns the record or nullptr if there is none
+		*/
+		[[nodiscard]] const IndexEntry *Find( const std::string &name ) const;
+
+		/**
+		 * \brief Compress a block of data in the LZ4 block format
+		 *
+		 * \param source Data to compress
+		 * \param size Size of the data
+		 *
+		 * \return Output returns the compressed data
+		*/
+		[[nodiscard]] static std::vector<char> CompressLZ4( const char *source, const std::size_t &size );
+
+		/**
+		 * \brief Decompress a block of data in the LZ4 block format
+		 *
+		 * \param source Compressed data
+		 * \param sourceSize Size of the compressed data
+		 * \param destination Buffer to decompress to
+		 * \param destinationSize Size of the decompressed data
+		 *
+		 * \return Output returns true if the data was valid and filled the buffer exactly
+		*/
+		static bool DecompressLZ4( const char *source, const std::size_t &sourceSize, char *destination, const std::size_t &destinationSize );
+
+		/**
+		 * \brief Start of the mapped archive
+		*/
+		const char *_data;
+
+		/**
+		 * \brief Size of the mapped archive
+		*/
+		std::size_t _size;
+
+		/**
+		 * \brief Decompressed entries, kept so fonts and music streaming from memory stay valid
+		*/
+		std::map<std::string, std::vector<char>> _decompressed;
+
+		/**
+		 * \brief Guards the decompressed entries, entries can be requested from the asset loader threads
+		*/
+		std::mutex _mutex;
+
+	};
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <Managers/AssetArchive.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureAtlas.hpp>
 #include <Graphics/Font.hpp>
 #include <Audio/Sound.hpp>
 #include <Audio/Music.hpp>
@@ -13,12 +15,30 @@ namespace Sonar
 		/**
 		 * \brief Default class constructor
 		*/
-		AssetManager( ) { }
+		AssetManager( ) : _loaders( DEFAULT_ASSET_LOADER_THREAD_COUNT ) { }
 
 		/** 
 		 * \brief Class destructor
 		*/
-		~AssetManager( ) { }
+		~AssetManager( );
+
+		/**
+		 * \brief Open a packed asset archive, loads of files it contains (including textures loaded straight by sprites) are served from the archive instead of the disk
+		 *
+		 * \param fileName Filepath and filename to the archive
+		 *
+		 * \return Output returns true if the archive was opened
+		*/
+		bool OpenArchive( const std::string &fileName );
+
+		/**
+		 * \brief Is a file contained in an opened archive
+		 *
+		 * \param fileName Filepath and filename as it was packed (e.g. "Resources/arial.ttf")
+		 *
+		 * \return Output returns true if the file is in an archive and false otherwise
+		*/
+		[[nodiscard]] bool IsInArchive( const std::string &fileName ) const;
 
 		/**
 		 * \brief Load a texture in the engine for later use
@@ -37,6 +57,48 @@ namespace Sonar
 		*/
 		[[nodiscard]] Texture &GetTexture( const std::string &name ) const;
 
+		/**
+		 * \brief Load a texture into the texture atlas so sprites using it can share a draw call, falls back to LoadTexture if it does not fit on a page
+		 *
+		 * \param name Texture name (used to retrieve it)
+		 * \param fileName Filepath and filename to the texture
+		*/
+		void LoadTextureIntoAtlas( const std::string &name, const std::string &fileName );
+
+		/**
+		 * \brief Load a prebuilt texture atlas, each region becomes available under its name
+		 *
+		 * \param fileName Filepath and filename to the atlas description
+		 *
+		 * \return Output returns true if the atlas was loaded
+		*/
+		bool LoadTextureAtlas( const std::string &fileName );
+
+		/**
+		 * \brief Is a texture packed into the texture atlas
+		 *
+		 * \param name Texture name
+		 *
+		 * \return Output returns true if the texture is in the atlas and false otherwise
+		*/
+		[[nodiscard]] bool IsInTextureAtlas( const std::string &name ) const;
+
+		/**
+		 * \brief Get the atlas region of a texture
+		 *
+		 * \param name Texture name
+		 *
+		 * \return Output returns the requested region
+		*/
+		[[nodiscard]] const TextureAtlas::Region &GetTextureAtlasRegion( const std::string &name ) const;
+
+		/**
+		 * \brief Get the texture atlas
+		 *
+		 * \return Output returns the texture atlas
+		*/
+		[[nodiscard]] TextureAtlas &GetTextureAtlas( );
+
 		/**
 		 * \brief Load a font in the engine for later use
 		 *
@@ -54,6 +116,15 @@ namespace Sonar
 		*/
 		[[nodiscard]] Font &GetFont( const std::string &name ) const;
 
+		/**
+		 * \brief Get a font by its file, loading it the first time so every user of the file shares the same glyphs
+		 *
+		 * \param fileName Filepath and filename to the font
+		 *
+		 * \return Output returns the requested font
+		*/
+		[[nodiscard]] Font &GetFontFromFile( const std::string &fileName );
+
 		/**
 		 * \brief Load a sound in the engine for later use
 		 *
@@ -88,17 +159,157 @@ namespace Sonar
 		*/
 		[[nodiscard]] Music &GetMusic( const std::string &name ) const;
 
+		/**
+		 * \brief Load a texture without blocking, the file is decoded on a worker thread and uploaded to the GPU by Update
+		 *
+		 * \param name Texture name (used to retrieve it)
+		 * \param fileName Filepath and filename to the texture
+		 *
+		 * \return Output returns a future that becomes ready once the texture can be retrieved
+		*/
+		std::shared_future<void> LoadTextureAsync( const std::string &name, const std::string &fileName );
+
+		/**
+		 * \brief Load a font without blocking, the file is parsed on a worker thread
+		 *
+		 * \param name Font name (used to retrieve it)
+		 * \param fileName Filepath and filename to the font
+		 *
+		 * \return Output returns a future that becomes ready once the font can be retrieved
+		*/
+		std::shared_future<void> LoadFontAsync( const std::string &name, const std::string &fileName );
+
+		/**
+		 * \brief Load a sound without blocking, the file is decoded on a worker thread
+		 *
+		 * \param name Sound name (used to retrieve it)
+		 * \param fileName Filepath and filename to the sound
+		 *
+		 * \return Output returns a future that becomes ready once the sound can be retrieved
+		*/
+		std::shared_future<void> LoadSoundAsync( const std::string &name, const std::string &fileName );
+
+		/**
+		 * \brief Load a music without blocking, the file is opened on a worker thread
+		 *
+		 * \param name Music name (used to retrieve it)
+		 * \param fileName Filepath and filename to the music
+		 *
+		 * \return Output returns a future that becomes ready once the music can be retrieved
+		*/
+		std::shared_future<void> LoadMusicAsync( const std::string &name, const std::string &fileName );
+
+		/**
+		 * \brief Finish asynchronous loads whose files have been decoded, must be called on the render thread
+		*/
+		void Update( );
+
+		/**
+		 * \brief Are any asynchronous loads still in progress
+		 *
+		 * \return Output returns true if assets are still loading and false otherwise
+		*/
+		[[nodiscard]] bool IsLoading( ) const;
+
+		/**
+		 * \brief Get the progress of the current batch of asynchronous loads
+		 *
+		 * \return Output returns the fraction of loads finished (0 - 1), 1 when nothing is loading
+		*/
+		[[nodiscard]] float GetLoadingProgress( ) const;
+
 	private:
+		/**
+		 * \brief Opened archives, declared first so they are unmapped after every asset reading from them (fonts and music keep reading the memory they were opened from)
+		*/
+		std::vector<std::unique_ptr<AssetArchive>> _archives;
+
+		/**
+		 * \brief Asynchronous load waiting to be finished on the render thread
+		*/
+		struct PendingLoad
+		{
+			std::future<std::function<void( )>> _decode; // Worker result, a function that stores (and uploads) the decoded asset
+			std::promise<void> _loaded;
+		};
+
+		/**
+		 * \brief Queue an asynchronous load
+		 *
+		 * \param decode Function run on a worker thread, returns the function that finishes the load on the render thread
+		 *
+		 * \return Output returns a future that becomes ready once the load is finished
+		*/
+		std::shared_future<void> QueueLoad( std::function<std::function<void( )>( )> decode );
+
+		/**
+		 * \brief Find the most recently opened archive containing a file
+		 *
+		 * \param fileName Filepath and filename as it was packed
+		 *
+		 * \return Output returns the archive or nullptr if no archive contains the file
+		*/
+		[[nodiscard]] AssetArchive *FindArchive( const std::string &fileName ) const;
+
+		/**
+		 * \brief Decode an image from an archive, or from the disk when archive is nullptr
+		 *
+		 * \param archive Archive containing the image
+		 * \param fileName Filepath and filename of the image
+		 * \param image Decoded image
+		*/
+		static void DecodeImage( AssetArchive *archive, const std::string &fileName, sf::Image &image );
+
+		/**
+		 * \brief Create a font from an archive, or from the disk when archive is nullptr
+		 *
+		 * \param archive Archive containing the font
+		 * \param fileName Filepath and filename of the font
+		 *
+		 * \return Output returns the font
+		*/
+		[[nodiscard]] static std::shared_ptr<Font> MakeFont( AssetArchive *archive, const std::string &fileName );
+
+		/**
+		 * \brief Create a sound from an archive, or from the disk when archive is nullptr
+		 *
+		 * \param archive Archive containing the sound
+		 * \param fileName Filepath and filename of the sound
+		 *
+		 * \return Output returns the sound
+		*/
+		[[nodiscard]] static std::shared_ptr<Sound> MakeSound( AssetArchive *archive, const std::string &fileName );
+
+		/**
+		 * \brief Create a music from an archive, or from the disk when archive is nullptr
+		 *
+		 * \param archive Archive containing the music
+		 * \param fileName Filepath and filename of the music
+		 *
+		 * \return Output returns the music
+		*/
+		[[nodiscard]] static std::shared_ptr<Music> MakeMusic( AssetArchive *archive, const std::string &fileName );
+
 		/**
 		 * \brief Textures map
 		*/
 		std::map<std::string, std::shared_ptr<Texture>> _textures;
 
+		/**
+		 * \brief Atlas textures are packed into
+		*/
+		TextureAtlas _textureAtlas;
+
 		/**
 		 * \brief Fonts map
 		*/
 		std::map<std::string, std::shared_ptr<Font>> _fonts;
 
+		/**
+		 * \brief Fonts loaded by GetFontFromFile, keyed by file apart from the named fonts so a name can never return another file's font
+		*/
+		std::map<std::string, std::shared_ptr<Font>> _fontsByFile;
+
 		/**
 		 * \brief Sounds map
 		*/
@@ -109,5 +320,20 @@ namespace Sonar
 		*/
 		std::map<std::string, std::shared_ptr<Music>> _musics;
 
+		/**
+		 * \brief Asynchronous loads still to be finished
+		*/
+		std::vector<PendingLoad> _pendingLoads;
+
+		/**
+		 * \brief Loads queued and finished since the asset manager was last idle, used for the progress
+		*/
+		unsigned int _loadsQueued = 0, _loadsFinished = 0;
+
+		/**
+		 * \brief Worker threads files are decoded on (declared last so the workers stop before the assets are destroyed)
+		*/
+		ThreadPool _loaders;
+
 	};
 }
@@ -2,6 +2,8 @@
 
 namespace Sonar
 {
+	class TileMap;
+
 	class MapManager
 	{
 	public:
@@ -77,11 +79,18 @@ namespace Sonar
 		[[nodiscard]] unsigned int GetSizeY( ) const;
 
 	private:
+		friend class TileMap;
+
 		/**
 		* \brief Delete the map pointer
 		*/
 		void DeleteMapPointer( );
 
+		/**
+		* \brief Tell every tile map drawing this map that all of it has changed
+		*/
+		void NotifyMapChanged( );
+
 		/**
 		* \brief 2D map of dynamic size
 		*/
@@ -92,5 +101,10 @@ namespace Sonar
 		*/
 		glm::uvec2 _arraySize;
 
+		/**
+		* \brief Tile maps drawing this map, told about every change so they can rebuild the affected chunks
+		*/
+		std::vector<TileMap *> _tileMaps;
+
 	};
 }
@@ -0,0 +1,108 @@
+#pragma once
+
+namespace Sonar
+{
+	/**
+	* \brief Solid pixels of a texture packed one bit per pixel into 64 bit words, built once per texture and alpha limit through the texture cache
+	*/
+	class Bitmask
+	{
+	public:
+		/**
+		* \brief Class constructor
+		*
+		* \param image Pixels of the texture
+		* \param alphaLimit Pixels with an alpha above this are solid
+		*/
+		Bitmask( const sf::Image &image, const unsigned char &alphaLimit );
+
+		/**
+		* \brief Is a pixel solid
+		*
+		* \param x Pixel column
+		* \param y Pixel row
+		*
+		* \return Output returns true if the pixel is solid, pixels outside the texture are never solid
+		*/
+		[[nodiscard]] bool IsSolid( const int &x, const int &y ) const;
+
+		/**
+		* \brief Get the width of the texture
+		*
+		* \return Output returns the width in pixels
+		*/
+		[[nodiscard]] const unsigned int &GetWidth( ) const;
+
+		/**
+		* \brief Get the height of the texture
+		*
+		* \return Output returns the height in pixels
+		*/
+		[[nodiscard]] const unsigned int &GetHeight( ) const;
+
+		/**
+		* \brief Check if the solid pixels of two sprites overlap, only the area where their bounds intersect is tested
+		*
+		* \param maskA Bitmask of the first sprite's texture
+		* \param spriteA First sprite
+		* \param maskB Bitmask of the second sprite's texture
+		* \param spriteB Second sprite
+		*
+		* \return Output returns true if any solid pixels overlap
+		*/
+		[[nodiscard]] static bool Test( const Bitmask &maskA, const sf::Sprite &spriteA, const Bitmask &maskB, const sf::Sprite &spriteB );
+
+	private:
+		/**
+		* \brief Test two unrotated and unscaled sprites by ANDing whole rows, 64 pixels at a time (128 with SSE2)
+		*
+		* \param maskA Bitmask of the first sprite's texture
+		* \param offsetA Pixel of the first texture at the top left of the overlap
+		* \param maskB Bitmask of the second sprite's texture
+		* \param offsetB Pixel of the second texture at the top left of the overlap
+		* \param size Width and height of the overlap in pixels
+		*
+		* \return Output returns true if any solid pixels overlap
+		*/
+		[[nodiscard]] static bool TestRows( const Bitmask &maskA, const glm::ivec2 &offsetA, const Bitmask &maskB, const glm::ivec2 &offsetB, const glm::ivec2 &size );
+
+		/**
+		* \brief Test two sprites pixel by pixel through their inverse transforms, used when either is rotated or scaled
+		*
+		* \param maskA Bitmask of the first sprite's texture
+		* \param spriteA First sprite
+		* \param maskB Bitmask of the second sprite's texture
+		* \param spriteB Second sprite
+		* \param intersection World space area both sprites cover
+		*
+		* \return Output returns true if any solid pixels overlap
+		*/
+		[[nodiscard]] static bool TestTransformed( const Bitmask &maskA, const sf::Sprite &spriteA, const Bitmask &maskB, const sf::Sprite &spriteB, const sf::FloatRect &intersection );
+
+		/**
+		* \brief Get 64 pixels of a row starting at any pixel
+		*
+		* \param row First word of the row
+		* \param bit First pixel
+		*
+		* \return Output returns the pixels, the first in the lowest bit
+		*/
+		[[nodiscard]] static std::uint64_t GetBits( const std::uint64_t *row, const int &bit );
+
+		/**
+		* \brief Width and height of the texture
+		*/
+		unsigned int _width, _height;
+
+		/**
+		* \brief Words per row, including two zero words of padding so 128 bits can be read from any pixel in the row
+		*/
+		unsigned int _stride;
+
+		/**
+		* \brief Rows of solid pixels, pixel x of a row is bit x % 64 of word x / 64
+		*/
+		std::vector<std::uint64_t> _words;
+
+	};
+}
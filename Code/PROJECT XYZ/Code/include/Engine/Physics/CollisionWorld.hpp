@@ -0,0 +1,257 @@
+#pragma once
+
+namespace Sonar
+{
+	class Drawable;
+
+	/**
+	* \brief Spatial hash of drawable colliders, finds what overlaps an area, a ray or another collider without testing every object against every other
+	*/
+	class CollisionWorld
+	{
+	public:
+		/**
+		* \brief Shape a drawable collides as
+		*/
+		enum class SHAPE
+		{
+			BOX, // Global bounds
+			CIRCLE // Largest circle inside the global bounds
+		};
+
+		/**
+		* \brief Closest collider a ray hits
+		*/
+		struct RaycastHit
+		{
+			Drawable *_drawable = nullptr;
+			glm::vec2 _point; // World space point the ray entered the collider
+			glm::vec2 _normal; // Surface normal at the point
+			float _distance = 0; // Distance along the ray to the point
+		};
+
+		/**
+		* \brief Class constructor
+		*
+		* \param cellSize Width and height of each cell in world units, roughly the size of a typical collider works best
+		*/
+		CollisionWorld( const float &cellSize = DEFAULT_COLLISION_WORLD_CELL_SIZE );
+
+		/**
+		* \brief Class destructor, detaches every drawable still in the world
+		*/
+		~CollisionWorld( );
+
+		CollisionWorld( const CollisionWorld & ) = delete;
+		CollisionWorld &operator=( const CollisionWorld & ) = delete;
+
+		/**
+		* \brief Add a drawable's collider, it follows the drawable as it moves until it is removed or destroyed
+		*
+		* \param drawable Object to add
+		* \param shape Shape the object collides as
+		*/
+		void Insert( Drawable &drawable, const SHAPE &shape = SHAPE::BOX );
+
+		/**
+		* \brief Remove a drawable's collider
+		*
+		* \param drawable Object to remove
+		*/
+		void Remove( Drawable &drawable );
+
+		/**
+		* \brief Mark a drawable's collider for moving to the cells its new bounds cover, called by the drawable whenever it is transformed
+		*
+		* \param drawable Object that has changed
+		*/
+		void Update( Drawable &drawable );
+
+		/**
+		* \brief Remove every collider
+		*/
+		void Clear( );
+
+		/**
+		* \brief Get the drawables whose colliders overlap an area
+		*
+		* \param bounds World space area (left, top, width, height)
+		* \param results Filled with the drawables found, cleared first so the same vector can be reused every frame
+		*/
+		void QueryAABB( const glm::vec4 &bounds, std::vector<Drawable *> &results );
+
+		/**
+		* \brief Get the drawables whose colliders overlap a circle
+		*
+		* \param center World space center of the circle
+		* \param radius Radius of the circle
+		* \param results Filled with the drawables found, cleared first so the same vector can be reused every frame
+		*/
+		void QueryCircle( const glm::vec2 &center, const float &radius, std::vector<Drawable *> &results );
+
+		/**
+		* \brief Find the closest collider along a ray, only the cells the ray passes through are checked
+		*
+		* \param origin World space start of the ray
+		* \param direction Direction of the ray (doesn't need to be normalised)
+		* \param maximumDistance Length of the ray
+		* \param hit Filled with the closest hit
+		*
+		* \return Output returns true if the ray hit a collider
+		*/
+		bool Raycast( const glm::vec2 &origin, const glm::vec2 &direction, const float &maximumDistance, RaycastHit &hit );
+
+		/**
+		* \brief Get every pair of overlapping colliders, each pair is reported once
+		*
+		* \param pairs Filled with the pairs found, cleared first so the same vector can be reused every frame
+		*/
+		void GetOverlappingPairs( std::vector<std::pair<Drawable *, Drawable *>> &pairs );
+
+		/**
+		* \brief Get the number of colliders in the world
+		*
+		* \return Output returns the number of colliders
+		*/
+		[[nodiscard]] unsigned int GetColliderCount( ) const;
+
+	private:
+		/**
+		* \brief Drawable's collider and the cells it is stored in
+		*/
+		struct Collider
+		{
+			Drawable *_drawable;
+			SHAPE _shape;
+			glm::vec4 _bounds; // Left, top, right, bottom
+			glm::ivec4 _cells; // First column, first row, last column, last row
+			unsigned int _queryStamp; // Last query that reported the collider, stops colliders covering several cells being reported twice
+			bool _isDirty; // Moved since its cells were last updated
+			bool _isOversized; // Covers too many cells, kept in the oversized list instead
+		};
+
+		/**
+		* \brief Get the cells an area covers
+		*
+		* \param bounds World space area (left, top, right, bottom)
+		*
+		* \return Output returns the first column, first row, last column and last row
+		*/
+		[[nodiscard]] glm::ivec4 GetCells( const glm::vec4 &bounds ) const;
+
+		/**
+		* \brief Does a range of cells hold too many for a collider to be stored in each of them
+		*
+		* \param cells Cells covered (first column, first row, last column, last row)
+		*
+		* \return Output returns true if a collider covering them is oversized
+		*/
+		[[nodiscard]] static bool IsOversized( const glm::ivec4 &cells );
+
+		/**
+		* \brief Recalculate a collider's bounds from its drawable
+		*
+		* \param collider Collider to update
+		*/
+		void CalculateBounds( Collider &collider ) const;
+
+		/**
+		* \brief Add a collider's index to every cell it covers, or to the oversized list if it covers too many
+		*
+		* \param index Collider index
+		*/
+		void AddToCells( const unsigned int &index );
+
+		/**
+		* \brief Remove a collider's index from every cell it covers, or from the oversized list
+		*
+		* \param index Collider index
+		*/
+		void RemoveFromCells( const unsigned int &index );
+
+		/**
+		* \brief Move every collider that has changed since the last query to its new cells
+		*/
+		void Refresh( );
+
+		/**
+		* \brief Call a function once for every collider in the cells an area covers and every oversized collider
+		*
+		* \param cells Cells to look in (first column, first row, last column, last row)
+		* \param function Function to call with each collider's index
+		*/
+		template <typename Function>
+		void ForEachInCells( const glm::ivec4 &cells, const Function &function );
+
+		/**
+		* \brief Do two colliders overlap
+		*
+		* \param a First collider
+		* \param b Second collider
+		*
+		* \return Output returns true if they overlap
+		*/
+		[[nodiscard]] static bool Overlaps( const Collider &a, const Collider &b );
+
+		/**
+		* \brief Does a collider overlap a circle
+		*
+		* \param collider Collider to test
+		* \param center Center of the circle
+		* \param radius Radius of the circle
+		*
+		* \return Output returns true if they overlap
+		*/
+		[[nodiscard]] static bool OverlapsCircle( const Collider &collider, const glm::vec2 &center, const float &radius );
+
+		/**
+		* \brief Find where a ray enters a collider
+		*
+		* \param collider Collider to test
+		* \param origin Start of the ray
+		* \param direction Normalised direction of the ray
+		* \param maximumDistance Length of the ray
+		* \param distance Distance along the ray the collider is entered, set on a hit
+		* \param normal Surface normal where the collider is entered, set on a hit
+		*
+		* \return Output returns true if the ray enters the collider within its length
+		*/
+		[[nodiscard]] static bool IntersectRay( const Collider &collider, const glm::vec2 &origin, const glm::vec2 &direction, const float &maximumDistance, float &distance, glm::vec2 &normal );
+
+		/**
+		* \brief Width and height of each cell
+		*/
+		float _cellSize;
+
+		/**
+		* \brief Every collider, packed so removing one moves the last into its place
+		*/
+		std::vector<Collider> _colliders;
+
+		/**
+		* \brief Collider indices by cell, a collider is stored in every cell its bounds cover
+		*/
+		std::unordered_map<std::int64_t, std::vector<unsigned int>> _cells;
+
+		/**
+		* \brief Colliders covering more than COLLISION_WORLD_MAX_COLLIDER_CELLS cells, checked by every query so one huge collider doesn't fill the hash
+		*/
+		std::vector<unsigned int> _oversized;
+
+		/**
+		* \brief Cells anything has been added to since the cells were last empty (first column, first row, last column, last row), rays stop once they leave them
+		*/
+		glm::ivec4 _occupied;
+
+		/**
+		* \brief Colliders that have moved since the last query
+		*/
+		std::vector<unsigned int> _dirty;
+
+		/**
+		* \brief Stamp of the current query
+		*/
+		unsigned int _queryStamp;
+
+	};
+}
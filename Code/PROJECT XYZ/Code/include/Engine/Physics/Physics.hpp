@@ -0,0 +1,326 @@
+#pragma once
+
+namespace Sonar
+{
+	class Drawable;
+
+	/**
+	* \brief Owns the Box2D world, steps it with the game's fixed step and writes body transforms back to the drawables attached to them
+	*
+	* With threading enabled each step runs on the physics thread while the game draws, one fixed step ahead of what is drawn. The world may only be touched from the game's Update (after Sync and before Step), everything else goes through the published transforms and contacts
+	*/
+	class Physics
+	{
+	public:
+		/**
+		* \brief Two fixtures starting or stopping touching during a step
+		*/
+		struct Contact
+		{
+			enum class TYPE
+			{
+				BEGIN,
+				END
+			};
+
+			TYPE _type;
+			b2Body *_bodyA, *_bodyB;
+			Drawable *_drawableA, *_drawableB; // nullptr for bodies not attached to a drawable
+		};
+
+		/**
+		* \brief Class constructor
+		*
+		* \param gravity Gravity in pixels per second squared
+		*/
+		Physics( const glm::vec2 &gravity = DEFAULT_PHYSICS_GRAVITY );
+
+		/**
+		* \brief Class destructor, destroys the world and every body in it
+		*/
+		~Physics( );
+
+		Physics( const Physics & ) = delete;
+		Physics &operator=( const Physics & ) = delete;
+
+		/**
+		* \brief Step the world, called by the game once per fixed step after the active state's Update (queued on the physics thread and published by the next Sync when threaded, published straight away otherwise)
+		*
+		* \param dt Fixed step length in seconds
+		*/
+		void Step( const float &dt );
+
+		/**
+		* \brief Wait for the queued step and publish its transforms (threaded only), then make the last step's contacts available to PollContact, called by the game before each fixed step's Update
+		*/
+		void Sync( );
+
+		/**
+		* \brief Get the next contact from the last step
+		*
+		* \param contact Contact object to fill in
+		*
+		* \return Output returns true if there was a contact
+		*/
+		bool PollContact( Contact &contact );
+
+		/**
+		* \brief Run each step on the physics thread, overlapping it with drawing
+		*/
+		void EnableThreading( );
+
+		/**
+		* \brief Run each step on the calling thread, waiting for any queued step first
+		*/
+		void DisableThreading( );
+
+		/**
+		* \brief Is each step run on the physics thread
+		*
+		* \return Output returns true if threaded
+		*/
+		[[nodiscard]] const bool &IsThreaded( ) const;
+
+		/**
+		* \brief Move every attached drawable between its body's last two steps, called by the game before drawing
+		*
+		* \param alpha How far between the last step and the next the frame is (0 to 1)
+		*/
+		void Interpolate( const float &alpha );
+
+		/**
+		* \brief Create a body that moves a drawable, the body is placed at the drawable's pivot and destroyed along with the drawable
+		*
+		* \param drawable Drawable to be moved by the body
+		* \param bodyDef Body settings, the position and angle are taken from the drawable
+		*
+		* \return Output returns the body
+		*/
+		b2Body *Attach( Drawable &drawable, b2BodyDef bodyDef );
+
+		/**
+		* \brief Destroy the body attached to a drawable, the drawable stays where it was last drawn
+		*
+		* \param drawable Drawable with a body
+		*/
+		void Detach( Drawable &drawable );
+
+		/**
+		* \brief Create a body that isn't attached to a drawable, it is stepped with the rest of the world but not interpolated and its contacts have no drawable (used by the entity component system)
+		*
+		* \param bodyDef Body settings, positions in meters
+		*
+		* \return Output returns the body
+		*/
+		b2Body *CreateBody( const b2BodyDef &bodyDef );
+
+		/**
+		* \brief Destroy a body created with CreateBody
+		*
+		* \param body Body to destroy
+		*/
+		void DestroyBody( b2Body *body );
+
+		/**
+		* \brief Get the Box2D world
+		*
+		* \return Output returns the world
+		*/
+		[[nodiscard]] b2World *GetWorld( ) const;
+
+		/**
+		* \brief Set the gravity
+		*
+		* \param gravity Gravity in pixels per second squared
+		*/
+		void SetGravity( const glm::vec2 &gravity );
+
+		/**
+		* \brief Get the gravity
+		*
+		* \return Output returns the gravity in pixels per second squared
+		*/
+		[[nodiscard]] glm::vec2 GetGravity( ) const;
+
+		/**
+		* \brief Set the number of velocity and position solver iterations per step, more is more accurate and slower
+		*
+		* \param velocityIterations Velocity iterations
+		* \param positionIterations Position iterations
+		*/
+		void SetIterations( const int &velocityIterations, const int &positionIterations );
+
+		/**
+		* \brief Get the number of velocity solver iterations per step
+		*
+		* \return Output returns the velocity iterations
+		*/
+		[[nodiscard]] const int &GetVelocityIterations( ) const;
+
+		/**
+		* \brief Get the number of position solver iterations per step
+		*
+		* \return Output returns the position iterations
+		*/
+		[[nodiscard]] const int &GetPositionIterations( ) const;
+
+		/**
+		* \brief Get the number of bodies attached to drawables
+		*
+		* \return Output returns the number of bodies
+		*/
+		[[nodiscard]] unsigned int GetAttachedCount( ) const;
+
+		/**
+		* \brief Convert pixels to Box2D meters
+		*
+		* \param pixels Distance in pixels
+		*
+		* \return Output returns the distance in meters
+		*/
+		[[nodiscard]] static float ToMeters( const float &pixels );
+
+		/**
+		* \brief Convert pixels to Box2D meters
+		*
+		* \param pixels Point or vector in pixels
+		*
+		* \return Output returns the point or vector in meters
+		*/
+		[[nodiscard]] static b2Vec2 ToMeters( const glm::vec2 &pixels );
+
+		/**
+		* \brief Convert Box2D meters to pixels
+		*
+		* \param meters Distance in meters
+		*
+		* \return Output returns the distance in pixels
+		*/
+		[[nodiscard]] static float ToPixels( const float &meters );
+
+		/**
+		* \brief Convert Box2D meters to pixels
+		*
+		* \param meters Point or vector in meters
+		*
+		* \return Output returns the point or vector in pixels
+		*/
+		[[nodiscard]] static glm::vec2 ToPixels( const b2Vec2 &meters );
+
+	private:
+		/**
+		* \brief Transforms of every attached body after a step, one array per attribute and indexed like the bodies
+		*/
+		struct Transforms
+		{
+			std::vector<float> _positionX, _positionY, _angle;
+
+			void Swap( Transforms &other );
+			void Resize( const std::size_t &size );
+			void Set( const std::size_t &index, const b2Body &body );
+			void Move( const std::size_t &from, const std::size_t &to );
+		};
+
+		/**
+		* \brief Records contacts into the pending list while the world steps
+		*/
+		struct ContactListener : public b2ContactListener
+		{
+			std::vector<Contact> *_contacts = nullptr;
+
+			void BeginContact( b2Contact *contact ) override;
+			void EndContact( b2Contact *contact ) override;
+		};
+
+		/**
+		* \brief Step the world and write every attached body's transform into the next transforms
+		*
+		* \param dt Step length in seconds
+		*/
+		void StepWorld( const float &dt );
+
+		/**
+		* \brief Make the next transforms current and the current ones previous
+		*/
+		void Publish( );
+
+		/**
+		* \brief Block until the physics thread has finished the queued step
+		*/
+		void WaitForStep( );
+
+		/**
+		* \brief Physics thread loop, runs steps as they are queued
+		*/
+		void RunThread( );
+
+		/**
+		* \brief Box2D world
+		*/
+		std::unique_ptr<b2World> _world;
+
+		/**
+		* \brief Solver iterations per step
+		*/
+		int _velocityIterations, _positionIterations;
+
+		/**
+		* \brief Attached bodies and the drawables they move
+		*/
+		std::vector<b2Body *> _bodies;
+		std::vector<Drawable *> _drawables;
+
+		/**
+		* \brief Whether each drawable already matches a body that has stopped, so it isn't written again
+		*/
+		std::vector<unsigned char> _isSettled;
+
+		/**
+		* \brief Transforms after the step before last and the last step, read by Interpolate, and the ones being written by the step in progress
+		*/
+		Transforms _previous, _current, _next;
+
+		/**
+		* \brief Contacts recorded by the step in progress and the ones ready to be polled
+		*/
+		std::vector<Contact> _pendingContacts;
+		std::deque<Contact> _contacts;
+
+		/**
+		* \brief Contact listener given to the world
+		*/
+		ContactListener _contactListener;
+
+		/**
+		* \brief Is each step run on the physics thread
+		*/
+		bool _isThreaded;
+
+		/**
+		* \brief Has a step been queued on the physics thread since the last Sync
+		*/
+		bool _isStepPending;
+
+		/**
+		* \brief Physics thread
+		*/
+		std::thread _thread;
+
+		/**
+		* \brief Guards the queued step between the game and physics threads
+		*/
+		std::mutex _threadMutex;
+		std::condition_variable _threadCondition;
+
+		/**
+		* \brief Is a step waiting for or running on the physics thread, and should the thread keep running
+		*/
+		bool _isStepQueued, _isThreadRunning;
+
+		/**
+		* \brief Length of the queued step
+		*/
+		float _queuedDt;
+
+	};
+}
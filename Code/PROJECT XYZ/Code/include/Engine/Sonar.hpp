@@ -11,16 +11,25 @@
 #include "Core/Clock.hpp"
 #include "Core/Debug.hpp"
 #include "Core/Game.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/SpatialHash.hpp"
 #include "Core/State.hpp"
 #include "Core/StateMachine.hpp"
+#include "Core/ThreadPool.hpp"
 #include "Core/Time.hpp"
 #include "Core/Window.hpp"
+#include "ECS/Components.hpp"
+#include "ECS/PhysicsSystem.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/RenderSystem.hpp"
+#include "ECS/SystemScheduler.hpp"
 #include "b2GLDraw.h"
 #include "pugixml.hpp"
 #include "Graphics/Button.hpp"
 #include "Graphics/ButtonGroup.hpp"
 #include "Graphics/Checkbox.hpp"
 #include "Graphics/Color.hpp"
+#include "Graphics/CullingGrid.hpp"
 #include "Graphics/Drawable.hpp"
 #include "Graphics/Font.hpp"
 #include "Graphics/Label.hpp"
@@ -28,9 +37,11 @@
 #include "Graphics/MenuComponent.hpp"
 #include "Graphics/Minimap.hpp"
 #include "Graphics/Parallax.hpp"
+#include "Graphics/ParticleEmitter.hpp"
 #include "Graphics/ProgressBar.hpp"
 #include "Graphics/RadioButton.hpp"
 #include "Graphics/RadioButtonGroup.hpp"
+#include "Graphics/RenderQueue.hpp"
 #include "Graphics/ScrollingBackground.hpp"
 #include "Graphics/Shapes/Circle.hpp"
 #include "Graphics/Shapes/Rectangle.hpp"
@@ -39,6 +50,9 @@
 #include "Graphics/Sprite.hpp"
 #include "Graphics/TextBox.hpp"
 #include "Graphics/Texture.hpp"
+#include "Graphics/TextureAtlas.hpp"
+#include "Graphics/TextureCache.hpp"
+#include "Graphics/TileMap.hpp"
 #include "Graphics/View.hpp"
 #include "Input/Events.hpp"
 #include "Input/Gesture.hpp"
@@ -50,8 +64,12 @@
 #include "Input/RBM.hpp"
 #include "Input/Sensor.hpp"
 #include "Input/Sequence.hpp"
+#include "Managers/AssetArchive.hpp"
 #include "Managers/AssetManager.hpp"
 #include "Managers/FileManager.hpp"
 #include "Managers/HighScoreManager.hpp"
 #include "Managers/MapManager.hpp"
+#include "Physics/Bitmask.hpp"
+#include "Physics/CollisionWorld.hpp"
+#include "Physics/Physics.hpp"
 
@@ -9,18 +9,35 @@
 */
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <condition_variable>
 #include <ctime>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <initializer_list>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <queue>
+#include <set>
 #include <sstream>
 #include <stack>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -42,6 +59,7 @@
 #include <Collision.hpp>
 #include <glm.hpp>
 #include <sort.h>
+#define NOMINMAX // Stops windows.h defining min and max macros that break std::min and std::max
 #include "SysInfo.hpp"
 #include <Gamepad.h>
 #include <csv.hpp>
@@ -56,6 +74,11 @@
 #include "Core/Debug.hpp"
 #include "Core/Time.hpp"
 #include "Core/Clock.hpp"
+#include "Core/ThreadPool.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/SpatialHash.hpp"
+#include "Physics/Physics.hpp"
+#include "Physics/Bitmask.hpp"
 #include "Graphics/Color.hpp"
 #include "Graphics/Font.hpp"
 #include "Graphics/ScrollingBackground.hpp"
@@ -67,8 +90,13 @@
 #include "Input/Keyboard.hpp"
 #include "Input/Mouse.hpp"
 #include "Input/Sequence.hpp"
+#include "Graphics/RenderQueue.hpp"
 #include "Graphics/Drawable.hpp"
+#include "Graphics/CullingGrid.hpp"
+#include "Physics/CollisionWorld.hpp"
 #include "Graphics/Texture.hpp"
+#include "Graphics/TextureAtlas.hpp"
+#include "Graphics/TextureCache.hpp"
 #include "Graphics/Sprite.hpp"
 #include "Graphics/Shapes/Triangle.hpp"
 #include "Graphics/Shapes/Rectangle.hpp"
@@ -96,7 +124,15 @@
 #include "Managers/HighScoreManager.hpp"
 #include "Managers/MapManager.hpp"
 #include "Core/Game.hpp"
+#include "Graphics/TileMap.hpp"
+#include "Graphics/ParticleEmitter.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/Components.hpp"
+#include "ECS/SystemScheduler.hpp"
+#include "ECS/PhysicsSystem.hpp"
+#include "ECS/RenderSystem.hpp"
 #include "Audio/AudioItem.hpp"
 #include "Audio/Music.hpp"
 #include "Audio/Sound.hpp"
+#include "Managers/AssetArchive.hpp"
 #include "Managers/AssetManager.hpp"
@@ -50,9 +50,6 @@ namespace Sonar
 
 		View *view;
 
-
-		AssetManager am;
-
 		
 		char windowTitle[255] = "ImGui + SFML = <3";
 
@@ -10,6 +10,14 @@ namespace Sonar
 		_musicObject = &_music;
 	}
 
+	Music::Music( const std::string &filepath, const void *data, const std::size_t &size ) : AudioItem( AUDIO_TYPE::MUSIC )
+	{
+		LoadFile( filepath );
+		_music.openFromMemory( data, size );
+
+		_musicObject = &_music;
+	}
+
 	Music::Music( ) : AudioItem( AUDIO_TYPE::MUSIC ) { }
 
 	Music::~Music( ) { }
@@ -11,6 +11,15 @@ namespace Sonar
 		_soundObject = &_sound;
 	}
 
+	Sound::Sound( const std::string &filepath, const void *data, const std::size_t &size ) : AudioItem( AUDIO_TYPE::SOUND )
+	{
+		LoadFile( filepath );
+		_buffer.loadFromMemory( data, size );
+		_sound.setBuffer( _buffer );
+
+		_soundObject = &_sound;
+	}
+
 	Sound::Sound( ) : AudioItem( AUDIO_TYPE::SOUND ) { }
 
 	Sound::~Sound( ) { }
@@ -145,6 +145,14 @@ namespace Sonar
 		}
 	}
 
+	void Debug::UpdateRenderData( const unsigned int batches, const unsigned int vertices, const unsigned int submissions, const unsigned int culled )
+	{
+		_frameData._batches = batches;
+		_frameData._vertices = vertices;
+		_frameData._submissions = submissions;
+		_frameData._culled = culled;
+	}
+
 	void Debug::DrawComputerStats( bool *pOpen, const glm::uvec2 &windowSize, const Verbosity verbosity, const float opacity )
 	{
 		static short int corner = COMPUTER_STATS_DEFAULT_CORNER;
@@ -219,6 +227,9 @@ namespace Sonar
 				{
 					ImGui::Text( "%.2fms", _frameData._frameTime );
 					ImGui::Text( "Frame : %llu", _frameData._totalFrames );
+					ImGui::Text( "Batches : %u (%u objects)", _frameData._batches, _frameData._submissions );
+					ImGui::Text( "Vertices : %u", _frameData._vertices );
+					ImGui::Text( "Culled : %u (%u drawn)", _frameData._culled, _frameData._submissions );
 				}
 
 				if ( verbosity >= Verbosity::HIGH )
@@ -315,13 +326,19 @@ namespace Sonar
 	{ return ( _isGridEnabled && _isGridEnabled ); }
 
 	void Debug::SetNumberOfGridSpacesX( const int &spaces )
-	{ _grid.numOfSpacesX = spaces; }
+	{
+		_grid.numOfSpacesX = spaces;
+		_isGridDirty = true;
+	}
 
 	const int &Debug::GetNumberOfGridSpacesX( ) const
 	{ return _grid.numOfSpacesX; }
 
 	void Debug::SetNumberOfGridSpacesY( const int &spaces )
-	{ _grid.numOfSpacesY = spaces; }
+	{
+		_grid.numOfSpacesY = spaces;
+		_isGridDirty = true;
+	}
 
 	const int &Debug::GetNumberOfGridSpacesY( ) const
 	{ return _grid.numOfSpacesY; }
@@ -330,56 +347,157 @@ namespace Sonar
 	{
 		_grid.numOfSpacesX = spacesX;
 		_grid.numOfSpacesY = spacesY;
+		_isGridDirty = true;
 	}
 
 	void Debug::SetNumberOfGridSpaces( const glm::uvec2 &spaces )
 	{
 		_grid.numOfSpacesX = spaces.x;
 		_grid.numOfSpacesY = spaces.y;
+		_isGridDirty = true;
 	}
 
 	const glm::uvec2 &Debug::GetNumberOfGridSpaces( ) const
 	{ return glm::uvec2( _grid.numOfSpacesX, _grid.numOfSpacesY ); }
 
 	void Debug::SetLineColor( const Color &color )
-	{ _grid.color = color; }
+	{
+		_grid.color = color;
+		_isGridDirty = true;
+	}
 
 	const Color &Debug::GetLineColor( ) const
 	{ return _grid.color; }
 
 	void Debug::SetLineWidth( const float &width )
-	{ _grid.lineWidth = width; }
+	{
+		_grid.lineWidth = width;
+		_isGridDirty = true;
+	}
 
 	const float &Debug::GetLineWidth( ) const
 	{ return _grid.lineWidth; }
 
 	void Debug::SetGridWidth( const float &width )
-	{ _grid.gridWidth = width; }
+	{
+		_grid.gridWidth = width;
+		_isGridDirty = true;
+	}
 
 	const float &Debug::GetGridWidth( ) const
 	{ return _grid.gridWidth; }
 
 	void Debug::EnableFixedWidth( )
-	{ _grid.isFixedWidth = true; }
+	{
+		_grid.isFixedWidth = true;
+		_isGridDirty = true;
+	}
 
 	void Debug::DisableFixedWidth( )
-	{ _grid.isFixedWidth = false; }
+	{
+		_grid.isFixedWidth = false;
+		_isGridDirty = true;
+	}
 
 	void Debug::ToggleFixedWidth( )
-	{ _grid.isFixedWidth = !_grid.isFixedWidth; }
+	{
+		_grid.isFixedWidth = !_grid.isFixedWidth;
+		_isGridDirty = true;
+	}
 
 	const bool &Debug::IsFixedWidthEnabled( ) const
 	{ return _grid.isFixedWidth; }
 
 	void Debug::EnableBorder( )
-	{ _grid.isBorderEnabled = true; }
+	{
+		_grid.isBorderEnabled = true;
+		_isGridDirty = true;
+	}
 
 	void Debug::DisableBorder( )
-	{ _grid.isBorderEnabled = false; }
+	{
+		_grid.isBorderEnabled = false;
+		_isGridDirty = true;
+	}
 
 	void Debug::ToggleBorder( )
-	{ _grid.isBorderEnabled = !_grid.isBorderEnabled; }
+	{
+		_grid.isBorderEnabled = !_grid.isBorderEnabled;
+		_isGridDirty = true;
+	}
 
 	const bool &Debug::IsBorderEnabled( ) const
 	{ return _grid.isBorderEnabled; }
+
+	const sf::VertexArray &Debug::GetGridVertices( const glm::uvec2 &windowSize )
+	{
+		if ( _isGridDirty || windowSize != _gridWindowSize )
+		{ BuildGrid( windowSize ); }
+
+		return _gridVertices;
+	}
+
+	void Debug::BuildGrid( const glm::uvec2 &windowSize )
+	{
+		_gridVertices.clear( );
+		_gridVertices.setPrimitiveType( sf::Triangles );
+
+		const float width = windowSize.x;
+		const float height = windowSize.y;
+		const float lineWidth = _grid.lineWidth;
+
+		if ( _grid.isFixedWidth )
+		{
+			if ( _grid.gridWidth > 0.0f )
+			{
+				const int gridSpacesX = width / _grid.gridWidth;
+				const int gridSpacesY = height / _grid.gridWidth;
+
+				for ( int i = 0; i <= gridSpacesX; i++ )
+				{ AddGridLine( _grid.gridWidth * i, 0, lineWidth, height ); }
+
+				for ( int j = 0; j <= gridSpacesY; j++ )
+				{ AddGridLine( 0, _grid.gridWidth * j, width, lineWidth ); }
+			}
+		}
+		else
+		{
+			const int x = _grid.numOfSpacesX - 1;
+			const int y = _grid.numOfSpacesY - 1;
+
+			for ( int i = 1; i <= x; i++ )
+			{ AddGridLine( ( ( width / ( x + 1.0f ) ) * i ) - ( lineWidth * 0.5f ), 0, lineWidth, height ); }
+
+			for ( int j = 1; j <= y; j++ )
+			{ AddGridLine( 0, ( ( height / ( y + 1.0f ) ) * j ) - ( lineWidth * 0.5f ), width, lineWidth ); }
+		}
+
+		if ( _grid.isBorderEnabled )
+		{
+			AddGridLine( 0, 0, width, lineWidth );
+			AddGridLine( 0, height - lineWidth, width, lineWidth );
+			AddGridLine( 0, 0, lineWidth, height );
+			AddGridLine( width - lineWidth, 0, lineWidth, height );
+		}
+
+		_gridWindowSize = windowSize;
+		_isGridDirty = false;
+	}
+
+	void Debug::AddGridLine( const float &x, const float &y, const float &width, const float &height )
+	{
+		const sf::Color color = _grid.color.GetColor( );
+
+		const sf::Vector2f topLeft( x, y );
+		const sf::Vector2f topRight( x + width, y );
+		const sf::Vector2f bottomRight( x + width, y + height );
+		const sf::Vector2f bottomLeft( x, y + height );
+
+		_gridVertices.append( sf::Vertex( topLeft, color ) );
+		_gridVertices.append( sf::Vertex( topRight, color ) );
+		_gridVertices.append( sf::Vertex( bottomRight, color ) );
+		_gridVertices.append( sf::Vertex( topLeft, color ) );
+		_gridVertices.append( sf::Vertex( bottomRight, color ) );
+		_gridVertices.append( sf::Vertex( bottomLeft, color ) );
+	}
 }
@@ -5,18 +5,44 @@ namespace Sonar
 {
 	static bool SHOW_SYSTEM_STATS_OVERLAY = SHOW_SYSTEM_STATS_OVERLAY_ON_LAUNCH;
 
-	Game::Game( const int &width, const int &height, const std::string &title )
+	Game::Game( const int &width, const int &height, const std::string &title, const bool &isThreaded )
 	{
+		_isThreaded = isThreaded;
+
         _data->debug = Debug::getInstance( );
         
 		Window::Style style;
 
 		_data->window.Setup( width, height, title, style );
-		_data->machine.AddState( StateRef( new SplashState( _data ) ) );
 
-		_data->world = new b2World( b2Vec2( 0.0f, 0.0f ) );
+		Init( );
+
+		if ( _isThreaded )
+		{ RunThreaded( ); }
+		else
+		{ Run( ); }
+	}
+
+	Game::Game( const int &width, const int &height, const HeadlessSettings &settings )
+	{
+		_isThreaded = false;
+		_headlessSettings = settings;
+
+        _data->debug = Debug::getInstance( );
+
+		_data->window.SetupHeadless( width, height, settings._isRendered );
+
+		Init( );
+
+		Run( );
+	}
+
+	void Game::Init( )
+	{
+		_data->renderQueue.SetTarget( &_data->window.GetRenderTarget( ) );
+		_data->machine.AddState( StateRef( new SplashState( _data ) ) );
 
-		_data->world->SetDebugDraw( &_data->fooDrawInstance );
+		_data->physics.GetWorld( )->SetDebugDraw( &_data->fooDrawInstance );
 		uint32 flags = 0;
 		flags += b2Draw::e_shapeBit;
 		flags += b2Draw::e_jointBit;
@@ -24,8 +50,14 @@ namespace Sonar
 		flags += b2Draw::e_pairBit;
 		flags += b2Draw::e_centerOfMassBit;
 		_data->fooDrawInstance.SetFlags( flags );
+	}
 
-		Run( );
+	bool Game::IsHeadlessLimitReached( const unsigned int &frames, const float &time ) const
+	{
+		if ( _headlessSettings._frameLimit > 0 && frames >= _headlessSettings._frameLimit )
+		{ return true; }
+
+		return _headlessSettings._timeLimit > 0.0f && time >= _headlessSettings._timeLimit;
 	}
 
 	void Game::Run( )
@@ -35,13 +67,22 @@ namespace Sonar
 		float currentTime = _clock.GetElapsedTime( ).AsSeconds( );
 		float accumulator = 0.0f;
 
+		const bool isHeadless = _data->window.IsHeadless( );
+		unsigned int frames = 0;
+		float gameTime = 0.0f;
+
 		while ( _data->window.IsOpen( ) )
 		{
 			_data->machine.ProcessStateChanges( );
+			_data->assets.Update( );
 
 			newTime = _clock.GetElapsedTime( ).AsSeconds( );
 			frameTime = newTime - currentTime;
 
+			// Off the clock every frame is exactly one step, so headless runs are repeatable and not held back by real time
+			if ( isHeadless && !_headlessSettings._isRealTime )
+			{ frameTime = _fixedFrameRate; }
+
 			if ( frameTime > 0.25f )
 			{ frameTime = 0.25f; }
 
@@ -50,6 +91,8 @@ namespace Sonar
 
 			while ( accumulator >= _fixedFrameRate )
 			{
+				_data->physics.Sync( );
+
 				Sonar::Event event;
                 
                 while ( _data->window.PollEvent( event ) )
@@ -64,106 +107,208 @@ namespace Sonar
                 }
                 
 				_data->machine.GetActiveState( )->Update( _fixedFrameRate );
+				_data->physics.Step( _fixedFrameRate );
 
 				accumulator -= _fixedFrameRate;
 			}
 
 			_data->dt = accumulator / _fixedFrameRate;
+			_data->physics.Interpolate( _data->dt );
 
 			_data->debug->UpdateFrameData( frameTime );
-            
-			_data->window.Clear( _data->backgroundColor );
 
-			ImGui::SFML::Update( _data->window.GetSFMLWindowObject( ), _imGUIClock.SFMLRestart( ) );
+			if ( _data->window.IsRendered( ) )
+			{
+				DrawFrame( );
+				PresentFrame( );
+			}
 
-			_data->machine.GetActiveState( )->Draw( _data->dt );
+			frames++;
+			gameTime += frameTime;
 
-			_data->debug->DrawComputerStats( &SHOW_SYSTEM_STATS_OVERLAY, _data->window.GetSize( ) );
+			if ( isHeadless && IsHeadlessLimitReached( frames, gameTime ) )
+			{
+				_data->machine.GetActiveState( )->Destructor( );
+				_data->window.CloseWindow( );
+			}
+		}
+	}
+
+	void Game::RunThreaded( )
+	{
+		// The simulation thread records each step's frame into a snapshot, this thread only draws the newest one
+		_data->renderQueue.EnableSnapshots( );
+
+		_isSimulationRunning = true;
 
-			ImGui::SFML::Render( _data->window.GetSFMLWindowObject( ) );
+		std::thread simulation( &Game::Simulate, this );
 
-			if ( _data->debug->IsGridEnabled( ) )
+		float currentTime = _clock.GetElapsedTime( ).AsSeconds( );
+
+		while ( _data->window.IsOpen( ) )
+		{
+			// The window can only be polled on the thread that created it, so events are handed to the simulation thread
+			Sonar::Event event;
+
+			while ( _data->window.PollEvent( event ) )
 			{
-				float lineWidth = _data->debug->GetLineWidth( );
+				if ( Sonar::Event::EventType::Closed == event.type )
+				{
+					std::lock_guard<std::mutex> lock( _stateMutex );
 
-				if ( _data->debug->IsFixedWidthEnabled( ) )
+					_data->machine.GetActiveState( )->Destructor( );
+					_data->window.CloseWindow( );
+				}
+				else
 				{
-					float gridWidth = _data->debug->GetGridWidth( );
+					std::lock_guard<std::mutex> lock( _eventMutex );
 
-					int gridSpacesX = _data->window.GetSize( ).x / gridWidth;
-					int gridSpacesY = _data->window.GetSize( ).y / gridWidth;
+					_pendingEvents.push_back( event );
+				}
+			}
 
-					for ( int i = 0; i <= gridSpacesX; i++ )
-					{
-						std::shared_ptr<Rectangle> line = std::make_shared<Rectangle>( _data, lineWidth, _data->window.GetSize( ).y );
+			if ( !_data->window.IsOpen( ) )
+			{ break; }
 
-						line->SetInsideColor( _data->debug->GetLineColor( ) );
-						line->SetPosition( gridWidth * i, 0 );
+			const float newTime = _clock.GetElapsedTime( ).AsSeconds( );
+			const float frameTime = newTime - currentTime;
+			currentTime = newTime;
 
-						line->Draw( );
-					}
+			// Nothing here touches the states, so the simulation keeps stepping while the snapshot is drawn
+			_data->window.Clear( _data->backgroundColor );
+			_data->renderQueue.DrawSnapshot( );
 
-					for ( int j = 0; j <= gridSpacesY; j++ )
-					{
-						std::shared_ptr<Rectangle> line = std::make_shared<Rectangle>( _data, _data->window.GetSize( ).x, lineWidth );
+			{
+				std::lock_guard<std::mutex> lock( _imGUIMutex );
 
-						line->SetInsideColor( _data->debug->GetLineColor( ) );
-						line->SetPosition( 0, gridWidth * j );
+				_data->debug->UpdateFrameData( frameTime );
 
-						line->Draw( );
-					}
-				}
-				else
-				{
-					int x = _data->debug->GetNumberOfGridSpacesX( ) - 1;
-					int y = _data->debug->GetNumberOfGridSpacesY( ) - 1;
+				// The interface is built along with the snapshot, there is nothing to render until the first one
+				if ( ImGui::GetFrameCount( ) > 0 )
+				{ ImGui::SFML::Render( _data->window.GetRenderTarget( ) ); }
 
-					for ( int i = 1; i <= x; i++ )
-					{
-						std::shared_ptr<Rectangle> line = std::make_shared<Rectangle>( _data, lineWidth, _data->window.GetSize( ).y );
+				if ( _data->debug->IsGridEnabled( ) )
+				{ _data->window.GetRenderTarget( ).draw( _data->debug->GetGridVertices( _data->window.GetSize( ) ) ); }
+			}
 
-						line->SetInsideColor( _data->debug->GetLineColor( ) );
-						line->SetPosition( ( ( _data->window.GetSize( ).x / ( x + 1.0f ) ) * i ) - ( lineWidth * 0.5f ), 0 );
+			PresentFrame( );
+		}
 
-						line->Draw( );
-					}
+		_isSimulationRunning = false;
+		simulation.join( );
+	}
 
-					for ( int j = 1; j <= y; j++ )
-					{
-						std::shared_ptr<Rectangle> line = std::make_shared<Rectangle>( _data, _data->window.GetSize( ).x, lineWidth );
+	void Game::Simulate( )
+	{
+		const auto step = std::chrono::duration_cast<std::chrono::steady_clock::duration>( std::chrono::duration<float>( _fixedFrameRate ) );
+		auto nextStep = std::chrono::steady_clock::now( );
 
-						line->SetInsideColor( _data->debug->GetLineColor( ) );
-						line->SetPosition( 0, ( ( _data->window.GetSize( ).y / ( y + 1.0f ) ) * j ) - ( lineWidth * 0.5f ) );
+		std::vector<Sonar::Event> events;
 
-						line->Draw( );
-					}
-				}
+		while ( _isSimulationRunning )
+		{
+			{
+				std::lock_guard<std::mutex> lock( _eventMutex );
+
+				// Swap the buffers so the render thread can keep queueing while this step's events are handled
+				events.swap( _pendingEvents );
+			}
+
+			{
+				std::lock_guard<std::mutex> lock( _stateMutex );
 
-				if ( _data->debug->IsBorderEnabled( ) )
+				if ( _data->window.IsOpen( ) )
 				{
-					std::shared_ptr<Rectangle> borderTop = std::make_shared<Rectangle>( _data, _data->window.GetSize( ).x, lineWidth );
-					std::shared_ptr<Rectangle> borderBottom = std::make_shared<Rectangle>( _data, _data->window.GetSize( ).x, lineWidth );
-					std::shared_ptr<Rectangle> borderLeft = std::make_shared<Rectangle>( _data, lineWidth, _data->window.GetSize( ).x );
-					std::shared_ptr<Rectangle> borderRight = std::make_shared<Rectangle>( _data, lineWidth, _data->window.GetSize( ).x );
-
-					borderTop->SetInsideColor( _data->debug->GetLineColor( ) );
-					borderBottom->SetInsideColor( _data->debug->GetLineColor( ) );
-					borderLeft->SetInsideColor( _data->debug->GetLineColor( ) );
-					borderRight->SetInsideColor( _data->debug->GetLineColor( ) );
-
-					borderTop->SetPosition( 0, 0 );
-					borderBottom->SetPosition( 0, _data->window.GetSize( ).y - borderBottom->GetHeight( ) );
-					borderLeft->SetPosition( 0, 0 );
-					borderRight->SetPosition( _data->window.GetSize( ).x - borderRight->GetWidth( ), 0 );
-
-					borderTop->Draw( );
-					borderBottom->Draw( );
-					borderLeft->Draw( );
-					borderRight->Draw( );
+					// The snapshot being drawn may use textures belonging to the state on its way out
+					if ( _data->machine.HasPendingChanges( ) )
+					{ _data->renderQueue.DiscardSnapshots( ); }
+
+					_data->machine.ProcessStateChanges( );
+					_data->assets.Update( );
+
+					_data->physics.Sync( );
+
+					{
+						// States hand their events to ImGui
+						std::lock_guard<std::mutex> imGUILock( _imGUIMutex );
+
+						for ( auto &event : events )
+						{ _data->machine.GetActiveState( )->PollInput( _fixedFrameRate, event ); }
+					}
+
+					_data->machine.GetActiveState( )->Update( _fixedFrameRate );
+					_data->physics.Step( _fixedFrameRate );
+
+					// Snapshots are drawn as they were recorded, so drawables are placed at the last published step instead of between steps
+					_data->dt = 1.0f;
+					_data->physics.Interpolate( _data->dt );
+
+					RecordFrame( );
 				}
 			}
-            
-            _data->window.Display( );
+
+			events.clear( );
+
+			nextStep += step;
+
+			// Same as the single threaded loop's 0.25 second cap, don't try to catch up after a long stall
+			if ( std::chrono::steady_clock::now( ) - nextStep > std::chrono::milliseconds( 250 ) )
+			{ nextStep = std::chrono::steady_clock::now( ); }
+
+			std::this_thread::sleep_until( nextStep );
 		}
 	}
+
+	void Game::RecordFrame( )
+	{
+		{
+			// ImGui has one context, the render thread renders the interface built here
+			std::lock_guard<std::mutex> lock( _imGUIMutex );
+
+			ImGui::SFML::Update( sf::Mouse::getPosition( _data->window.GetSFMLWindowObject( ) ), sf::Vector2f( _data->window.GetSize( ).x, _data->window.GetSize( ).y ), _imGUIClock.SFMLRestart( ) );
+
+			_data->machine.GetActiveState( )->Draw( _data->dt );
+
+			_data->debug->DrawComputerStats( &SHOW_SYSTEM_STATS_OVERLAY, _data->window.GetSize( ) );
+
+			// Ended here rather than by the render thread, which may render the same interface several times or not at all
+			ImGui::EndFrame( );
+		}
+
+		_data->renderQueue.PublishSnapshot( );
+	}
+
+	void Game::DrawFrame( )
+	{
+		_data->window.Clear( _data->backgroundColor );
+
+		if ( _data->window.IsHeadless( ) )
+		{ ImGui::SFML::Update( sf::Vector2i( ), sf::Vector2f( _data->window.GetSize( ).x, _data->window.GetSize( ).y ), _imGUIClock.SFMLRestart( ) ); }
+		else
+		{ ImGui::SFML::Update( _data->window.GetSFMLWindowObject( ), _imGUIClock.SFMLRestart( ) ); }
+
+		_data->machine.GetActiveState( )->Draw( _data->dt );
+
+		_data->renderQueue.Flush( );
+
+		_data->debug->DrawComputerStats( &SHOW_SYSTEM_STATS_OVERLAY, _data->window.GetSize( ) );
+
+		ImGui::SFML::Render( _data->window.GetRenderTarget( ) );
+
+		_data->renderQueue.Flush( );
+
+		if ( _data->debug->IsGridEnabled( ) )
+		{ _data->window.GetRenderTarget( ).draw( _data->debug->GetGridVertices( _data->window.GetSize( ) ) ); }
+	}
+
+	void Game::PresentFrame( )
+	{
+		_data->window.Display( );
+
+		_data->renderQueue.EndFrame( );
+
+		std::lock_guard<std::mutex> lock( _imGUIMutex );
+
+		_data->debug->UpdateRenderData( _data->renderQueue.GetBatchCount( ), _data->renderQueue.GetVertexCount( ), _data->renderQueue.GetSubmissionCount( ), _data->renderQueue.GetCulledCount( ) );
+	}
 }
@@ -0,0 +1,281 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+    // Job system and index of the worker running on this thread, nullptr and -1 for threads outside any job system
+    static thread_local const JobSystem *WORKER_OWNER = nullptr;
+    static thread_local int WORKER_INDEX = -1;
+
+    static int GetWorkerIndex( const JobSystem *jobSystem )
+    { return WORKER_OWNER == jobSystem ? WORKER_INDEX : -1; }
+
+    unsigned int JobGraph::AddTask( std::function<void( )> task, const std::vector<unsigned int> &dependencies )
+    {
+        const unsigned int index = _nodes.size( );
+
+        Node node;
+        node._task = std::move( task );
+        node._remaining = std::make_unique<std::atomic<unsigned int>>( 0 );
+
+        for ( const auto &dependency : dependencies )
+        {
+            if ( dependency < index )
+            {
+                _nodes.at( dependency )._dependents.push_back( index );
+                node._dependencyCount++;
+            }
+        }
+
+        _nodes.push_back( std::move( node ) );
+
+        return index;
+    }
+
+    void JobGraph::Clear( )
+    { _nodes.clear( ); }
+
+    unsigned int JobGraph::GetTaskCount( ) const
+    { return _nodes.size( ); }
+
+    JobSystem::JobSystem( const unsigned int &threadCount )
+    {
+        _queuedJobs = 0;
+        _nextQueue = 0;
+        _isStopping = false;
+
+        unsigned int count = threadCount;
+
+        if ( 0 == count )
+        { count = std::max( 2u, std::thread::hardware_concurrency( ) ) - 1; }
+
+        for ( unsigned int i = 0; i < count; i++ )
+        { _queues.push_back( std::make_unique<Queue>( ) ); }
+
+        for ( unsigned int i = 0; i < count; i++ )
+        { _workers.emplace_back( &JobSystem::Work, this, i ); }
+    }
+
+    JobSystem::~JobSystem( )
+    {
+        {
+            std::lock_guard<std::mutex> lock( _sleepMutex );
+            _isStopping = true;
+        }
+
+        _sleepCondition.notify_all( );
+
+        for ( auto &worker : _workers )
+        { worker.join( ); }
+    }
+
+    void JobSystem::Run( std::function<void( )> job, JobCounter *counter )
+    {
+        if ( nullptr == counter )
+        {
+            Push( std::move( job ) );
+
+            return;
+        }
+
+        counter->_value++;
+
+        Push( [job = std::move( job ), counter]( )
+        {
+            RunCatching( job, *counter );
+
+            counter->_value--;
+        } );
+    }
+
+    void JobSystem::Run( JobGraph &graph, JobCounter &counter )
+    {
+        counter._value += graph._nodes.size( );
+
+        for ( auto &node : graph._nodes )
+        { *node._remaining = node._dependencyCount; }
+
+        for ( unsigned int i = 0; i < graph._nodes.size( ); i++ )
+        {
+            if ( 0 == graph._nodes.at( i )._dependencyCount )
+            { QueueTask( graph, i, counter ); }
+        }
+    }
+
+    void JobSystem::Wait( JobCounter &counter )
+    {
+        while ( counter._value > 0 )
+        {
+            if ( !RunOne( ) )
+            { std::this_thread::yield( ); }
+        }
+
+        std::exception_ptr exception;
+
+        {
+            std::lock_guard<std::mutex> lock( counter._exceptionMutex );
+            std::swap( exception, counter._exception );
+        }
+
+        if ( exception )
+        { std::rethrow_exception( exception ); }
+    }
+
+    void JobSystem::ParallelFor( const unsigned int &count, const unsigned int &grainSize, const std::function<void( unsigned int, unsigned int )> &body )
+    {
+        if ( 0 == count )
+        { return; }
+
+        // Enough chunks for every worker and the calling thread, but none smaller than the grain size
+        const unsigned int threads = _workers.size( ) + 1;
+        const unsigned int chunkSize = std::max( std::max( 1u, grainSize ), ( count + threads - 1 ) / threads );
+
+        if ( chunkSize >= count )
+        {
+            body( 0, count );
+
+            return;
+        }
+
+        JobCounter counter;
+
+        for ( unsigned int begin = chunkSize; begin < count; begin += chunkSize )
+        {
+            const unsigned int end = std::min( count, begin + chunkSize );
+
+            Run( [&body, begin, end]( ) { body( begin, end ); }, &counter );
+        }
+
+        // Caught like the queued chunks, the queued ones hold references to the body and counter so this can't return before they finish
+        RunCatching( [&body, chunkSize]( ) { body( 0, chunkSize ); }, counter );
+
+        Wait( counter );
+    }
+
+    unsigned int JobSystem::GetThreadCount( ) const
+    { return _workers.size( ); }
+
+    void JobSystem::Push( std::function<void( )> job )
+    {
+        const int worker = GetWorkerIndex( this );
+        const unsigned int index = worker >= 0 ? worker : _nextQueue++ % _queues.size( );
+        Queue &queue = *_queues.at( index );
+
+        {
+            // Counted before it is queued so the count never drops below zero, and under the lock so a worker about to sleep can't miss it
+            std::lock_guard<std::mutex> lock( _sleepMutex );
+            _queuedJobs++;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( queue._mutex );
+            queue._jobs.push_back( std::move( job ) );
+        }
+
+        _sleepCondition.notify_one( );
+    }
+
+    bool JobSystem::Pop( std::function<void( )> &job )
+    {
+        const unsigned int count = _queues.size( );
+        const int worker = GetWorkerIndex( this );
+        const unsigned int start = worker >= 0 ? worker : 0;
+
+        for ( unsigned int i = 0; i < count; i++ )
+        {
+            Queue &queue = *_queues.at( ( start + i ) % count );
+            std::lock_guard<std::mutex> lock( queue._mutex );
+
+            if ( queue._jobs.empty( ) )
+            { continue; }
+
+            // Newest job from our own queue (still warm in cache), oldest from anyone else's
+            if ( 0 == i && worker >= 0 )
+            {
+                job = std::move( queue._jobs.back( ) );
+                queue._jobs.pop_back( );
+            }
+            else
+            {
+                job = std::move( queue._jobs.front( ) );
+                queue._jobs.pop_front( );
+            }
+
+            _queuedJobs--;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void JobSystem::RunCatching( const std::function<void( )> &job, JobCounter &counter )
+    {
+        try
+        { job( ); }
+        catch ( ... )
+        {
+            std::lock_guard<std::mutex> lock( counter._exceptionMutex );
+
+            if ( !counter._exception )
+            { counter._exception = std::current_exception( ); }
+        }
+    }
+
+    bool JobSystem::RunOne( )
+    {
+        std::function<void( )> job;
+
+        if ( !Pop( job ) )
+        { return false; }
+
+        // Only a job queued without a counter can get here with an exception, there is nobody to hand it to
+        try
+        { job( ); }
+        catch ( const std::exception &exception )
+        { spdlog::error( std::string( "Job threw an exception: " ) + exception.what( ) ); }
+        catch ( ... )
+        { spdlog::error( "Job threw an exception" ); }
+
+        return true;
+    }
+
+    void JobSystem::FinishTask( JobGraph &graph, const unsigned int &index, JobCounter &counter )
+    {
+        for ( const auto &dependent : graph._nodes.at( index )._dependents )
+        {
+            if ( 1 == ( *graph._nodes.at( dependent )._remaining )-- )
+            { QueueTask( graph, dependent, counter ); }
+        }
+
+        counter._value--;
+    }
+
+    void JobSystem::QueueTask( JobGraph &graph, const unsigned int &index, JobCounter &counter )
+    {
+        Push( [this, &graph, index, &counter]( )
+        {
+            // A task that throws still unblocks its dependents, so Wait sees the counter reach zero and rethrows
+            RunCatching( graph._nodes.at( index )._task, counter );
+
+            FinishTask( graph, index, counter );
+        } );
+    }
+
+    void JobSystem::Work( const unsigned int &index )
+    {
+        WORKER_OWNER = this;
+        WORKER_INDEX = index;
+
+        while ( true )
+        {
+            if ( RunOne( ) )
+            { continue; }
+
+            std::unique_lock<std::mutex> lock( _sleepMutex );
+            _sleepCondition.wait( lock, [this]( ) { return _isStopping || _queuedJobs > 0; } );
+
+            if ( _isStopping && 0 == _queuedJobs )
+            { return; }
+        }
+    }
+}
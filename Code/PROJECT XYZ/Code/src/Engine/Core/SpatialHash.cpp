@@ -0,0 +1,13 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	std::int64_t SpatialHash::GetCellKey( const int &x, const int &y )
+	{ return ( static_cast<std::int64_t>( x ) << 32 ) | static_cast<std::uint32_t>( y ); }
+
+	glm::ivec2 SpatialHash::GetCellFromKey( const std::int64_t &key )
+	{ return glm::ivec2( static_cast<int>( key >> 32 ), static_cast<int>( static_cast<std::int32_t>( key & 0xFFFFFFFF ) ) ); }
+
+	glm::ivec2 SpatialHash::GetCell( const glm::vec2 &point, const float &cellSize )
+	{ return glm::ivec2( std::floor( point.x / cellSize ), std::floor( point.y / cellSize ) ); }
+}
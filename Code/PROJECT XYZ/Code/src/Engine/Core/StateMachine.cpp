@@ -50,6 +50,9 @@ namespace Sonar
 		}
 	}
 
+	bool StateMachine::HasPendingChanges( ) const
+	{ return _isAdding || _isRemoving; }
+
 	StateRef &StateMachine::GetActiveState( )
 	{ return _states.top( ); }
 }
@@ -0,0 +1,49 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+    ThreadPool::ThreadPool( const unsigned int &threadCount )
+    {
+        _isStopping = false;
+
+        for ( unsigned int i = 0; i < std::max( 1u, threadCount ); i++ )
+        { _workers.emplace_back( &ThreadPool::Work, this ); }
+    }
+
+    ThreadPool::~ThreadPool( )
+    {
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            _isStopping = true;
+        }
+
+        _condition.notify_all( );
+
+        for ( auto &worker : _workers )
+        { worker.join( ); }
+    }
+
+    unsigned int ThreadPool::GetThreadCount( ) const
+    { return _workers.size( ); }
+
+    void ThreadPool::Work( )
+    {
+        while ( true )
+        {
+            std::function<void( )> task;
+
+            {
+                std::unique_lock<std::mutex> lock( _mutex );
+                _condition.wait( lock, [this]( ) { return _isStopping || !_tasks.empty( ); } );
+
+                if ( _isStopping && _tasks.empty( ) )
+                { return; }
+
+                task = std::move( _tasks.front( ) );
+                _tasks.pop( );
+            }
+
+            task( );
+        }
+    }
+}
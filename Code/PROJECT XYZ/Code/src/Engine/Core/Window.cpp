@@ -18,20 +18,57 @@ namespace Sonar
 	void Window::Setup( const std::string &title, const Style &style, const ContextSettings &contextSettings )
 	{ _window.create( sf::VideoMode( SCREEN_WIDTH, SCREEN_HEIGHT ), title, CalculateStyle( style ), ConvertContextSettingsToSFMLObject( contextSettings ) ); }
 
+	void Window::SetupHeadless( const unsigned int &width, const unsigned int &height, const bool &isRendered )
+	{
+		_isHeadless = _isHeadlessOpen = true;
+		_isHeadlessRendered = isRendered;
+		_headlessSize = glm::uvec2( width, height );
+
+		if ( _isHeadlessRendered )
+		{ _offscreen.create( width, height ); }
+	}
+
+	bool Window::IsHeadless( ) const
+	{ return _isHeadless; }
+
+	bool Window::IsRendered( ) const
+	{ return !_isHeadless || _isHeadlessRendered; }
+
+	sf::RenderTarget &Window::GetRenderTarget( )
+	{
+		if ( _isHeadless )
+		{ return _offscreen; }
+
+		return _window;
+	}
+
+	const sf::Texture &Window::GetOffscreenTexture( ) const
+	{ return _offscreen.getTexture( ); }
+
 	sf::RenderWindow &Window::GetSFMLWindowObject( )
 	{ return _window; }
 
 	void Window::CloseWindow( )
-	{ _window.close( ); }
+	{
+		if ( _isHeadless )
+		{ _isHeadlessOpen = false; }
+		else
+		{ _window.close( ); }
+	}
 
 	void Window::Display( )
-	{ _window.display( ); }
+	{
+		if ( !_isHeadless )
+		{ _window.display( ); }
+		else if ( _isHeadlessRendered )
+		{ _offscreen.display( ); }
+	}
 
 	void Window::Clear( const Color &color )
-	{ _window.clear( sf::Color( color.GetRed( ), color.GetGreen( ), color.GetBlue( ), color.GetAlpha( ) ) ); }
+	{ GetRenderTarget( ).clear( sf::Color( color.GetRed( ), color.GetGreen( ), color.GetBlue( ), color.GetAlpha( ) ) ); }
 
 	bool Window::IsOpen( ) const
-	{ return _window.isOpen( ); }
+	{ return _isHeadless ? _isHeadlessOpen : _window.isOpen( ); }
 
 	const Sonar::Window::ContextSettings &Window::GetSettings( )
 	{
@@ -44,6 +81,10 @@ namespace Sonar
 
 	bool Window::PollEvent( Event &event )
 	{
+		// Nothing to poll without a window
+		if ( _isHeadless )
+		{ return false; }
+
 		bool isEvent = _window.pollEvent( event.GetSFMLEventObject( ) );
 
 		event.Update( );
@@ -53,6 +94,9 @@ namespace Sonar
 
 	bool Window::WaitEvent( Event &event )
 	{
+		if ( _isHeadless )
+		{ return false; }
+
 		bool isEvent = _window.waitEvent( event.GetSFMLEventObject( ) );
 
 		event.Update( );
@@ -72,6 +116,9 @@ namespace Sonar
 
 	glm::uvec2 Window::GetSize( ) const
 	{
+		if ( _isHeadless )
+		{ return _headlessSize; }
+
 		auto size = _window.getSize( );
 
 		return glm::uvec2( size.x, size.y );
@@ -125,10 +172,10 @@ namespace Sonar
 	{ return _window.hasFocus( ); }
 
 	void Window::SetView( const View view )
-	{ _window.setView( view.GetSFMLViewObject( ) ); }
+	{ GetRenderTarget( ).setView( view.GetSFMLViewObject( ) ); }
 
 	void Window::SetDefaultView( )
-	{ _window.setView( _window.getDefaultView( ) ); }
+	{ GetRenderTarget( ).setView( GetRenderTarget( ).getDefaultView( ) ); }
 
 	const glm::vec2 &Window::GetPointOnScreen( const bool isWindow, const POINTS &point )
 	{
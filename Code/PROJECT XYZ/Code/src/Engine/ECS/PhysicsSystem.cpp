@@ -0,0 +1,105 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	BodyComponent::BodyComponent( Physics *physics, b2Body *body ) : _physics( physics ), _body( body )
+	{
+		_previousPosition = _currentPosition = ( nullptr != body ) ? Physics::ToPixels( body->GetPosition( ) ) : glm::vec2( 0, 0 );
+		_previousRotation = _currentRotation = ( nullptr != body ) ? glm::degrees( body->GetAngle( ) ) : 0.0f;
+	}
+
+	BodyComponent::~BodyComponent( )
+	{
+		if ( nullptr != _physics )
+		{ _physics->DestroyBody( _body ); }
+	}
+
+	BodyComponent::BodyComponent( BodyComponent &&other ) noexcept
+	{
+		_physics = other._physics;
+		_body = other._body;
+		_previousPosition = other._previousPosition;
+		_currentPosition = other._currentPosition;
+		_previousRotation = other._previousRotation;
+		_currentRotation = other._currentRotation;
+
+		other._physics = nullptr;
+		other._body = nullptr;
+	}
+
+	BodyComponent &BodyComponent::operator=( BodyComponent &&other ) noexcept
+	{
+		if ( this != &other )
+		{
+			if ( nullptr != _physics )
+			{ _physics->DestroyBody( _body ); }
+
+			_physics = other._physics;
+			_body = other._body;
+			_previousPosition = other._previousPosition;
+			_currentPosition = other._currentPosition;
+			_previousRotation = other._previousRotation;
+			_currentRotation = other._currentRotation;
+
+			other._physics = nullptr;
+			other._body = nullptr;
+		}
+
+		return *this;
+	}
+
+	PhysicsSystem::PhysicsSystem( GameDataRef data ) : _data( data )
+	{ }
+
+	b2Body *PhysicsSystem::CreateBody( Registry &registry, const Entity &entity, b2BodyDef bodyDef, const b2Shape &shape, const float &density, const float &friction )
+	{
+		const TransformComponent *transform = registry.GetComponent<TransformComponent>( entity );
+
+		if ( nullptr == transform )
+		{ return nullptr; }
+
+		bodyDef.position = Physics::ToMeters( transform->_position );
+		bodyDef.angle = glm::radians( transform->_rotation );
+
+		b2Body *body = _data->physics.CreateBody( bodyDef );
+
+		b2FixtureDef fixtureDef;
+		fixtureDef.density = density;
+		fixtureDef.friction = friction;
+		fixtureDef.shape = &shape;
+		body->CreateFixture( &fixtureDef );
+
+		registry.AddComponent( entity, BodyComponent( &_data->physics, body ) );
+
+		return body;
+	}
+
+	void PhysicsSystem::Update( Registry &registry )
+	{
+		registry.GetView<BodyComponent>( ).ForEach( []( BodyComponent &body )
+		{
+			body._previousPosition = body._currentPosition;
+			body._previousRotation = body._currentRotation;
+			body._currentPosition = Physics::ToPixels( body._body->GetPosition( ) );
+			body._currentRotation = glm::degrees( body._body->GetAngle( ) );
+		} );
+	}
+
+	void PhysicsSystem::Interpolate( Registry &registry, const float &alpha )
+	{
+		registry.GetView<BodyComponent, TransformComponent>( ).ParallelForEach( _data->jobs, [alpha]( BodyComponent &body, TransformComponent &transform )
+		{
+			transform._position = glm::mix( body._previousPosition, body._currentPosition, alpha );
+			transform._rotation = glm::mix( body._previousRotation, body._currentRotation, alpha );
+		} );
+	}
+
+	void PhysicsSystem::Integrate( Registry &registry, const float &dt )
+	{
+		registry.GetView<VelocityComponent, TransformComponent>( ).ParallelForEach( _data->jobs, [dt]( VelocityComponent &velocity, TransformComponent &transform )
+		{
+			transform._position += velocity._velocity * dt;
+			transform._rotation += velocity._angularVelocity * dt;
+		} );
+	}
+}
@@ -0,0 +1,255 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	std::array<Registry::ComponentInfo, ECS_MAX_COMPONENT_TYPES> Registry::_componentInfos;
+	unsigned int Registry::_componentTypeCount = 0;
+	std::mutex Registry::_componentTypeMutex;
+
+	Registry::Registry( ) : _entityCount( 0 )
+	{ }
+
+	Registry::~Registry( )
+	{ Clear( ); }
+
+	void Registry::DestroyEntity( const Entity &entity )
+	{
+		if ( !IsAlive( entity ) )
+		{ return; }
+
+		Record &record = _records[entity._index];
+
+		RemoveRow( *record._archetype, record._row );
+
+		record._archetype = nullptr;
+		record._generation++;
+		_freeIndices.push_back( entity._index );
+		_entityCount--;
+	}
+
+	bool Registry::IsAlive( const Entity &entity ) const
+	{ return entity._index < _records.size( ) && nullptr != _records[entity._index]._archetype && _records[entity._index]._generation == entity._generation; }
+
+	void Registry::Clear( )
+	{
+		for ( auto archetype : _archetypeList )
+		{
+			for ( std::size_t i = 0; i < archetype->_types.size( ); i++ )
+			{
+				const ComponentInfo &info = GetComponentInfo( archetype->_types[i] );
+
+				for ( std::size_t row = 0; row < archetype->_entities.size( ); row++ )
+				{ info._destroy( archetype->_arrays[i] + ( row * info._size ) ); }
+			}
+
+			archetype->_entities.clear( );
+			FreeArrays( *archetype );
+		}
+
+		// Generations carry on rising so handles from before the clear stay dead
+		_freeIndices.clear( );
+
+		for ( std::uint32_t i = static_cast<std::uint32_t>( _records.size( ) ); i > 0; i-- )
+		{
+			Record &record = _records[i - 1];
+
+			if ( nullptr != record._archetype )
+			{
+				record._archetype = nullptr;
+				record._generation++;
+			}
+
+			_freeIndices.push_back( i - 1 );
+		}
+
+		_entityCount = 0;
+	}
+
+	unsigned int Registry::GetEntityCount( ) const
+	{ return _entityCount; }
+
+	unsigned int Registry::GetArchetypeCount( ) const
+	{ return static_cast<unsigned int>( _archetypeList.size( ) ); }
+
+	void *Registry::Archetype::GetPointer( const unsigned int &type, const std::size_t &row ) const
+	{
+		const int index = _arrayOfType[type];
+
+		return _arrays[index] + ( row * GetComponentInfo( type )._size );
+	}
+
+	unsigned int Registry::RegisterComponentType( const std::size_t &size, const std::size_t &alignment, void ( *move )( void *, void * ), void ( *destroy )( void * ) )
+	{
+		std::lock_guard<std::mutex> lock( _componentTypeMutex );
+
+		static_assert( ECS_MAX_COMPONENT_TYPES <= std::numeric_limits<ComponentMask>::digits, "A component mask needs one bit per component type" );
+
+		// A mask has one bit per type, so there is nowhere to put another, checked in every build as going on would write past the component infos
+		if ( _componentTypeCount >= ECS_MAX_COMPONENT_TYPES )
+		{ throw std::length_error( "Too many entity component types, raise ECS_MAX_COMPONENT_TYPES" ); }
+
+		ComponentInfo &info = _componentInfos[_componentTypeCount];
+
+		info._size = size;
+		info._alignment = alignment;
+		info._move = move;
+		info._destroy = destroy;
+
+		return _componentTypeCount++;
+	}
+
+	const Registry::ComponentInfo &Registry::GetComponentInfo( const unsigned int &type )
+	{ return _componentInfos[type]; }
+
+	Registry::Archetype &Registry::GetArchetype( const ComponentMask &mask )
+	{
+		std::unique_ptr<Archetype> &archetype = _archetypes[mask];
+
+		if ( nullptr != archetype )
+		{ return *archetype; }
+
+		archetype = std::make_unique<Archetype>( );
+		archetype->_mask = mask;
+		archetype->_arrayOfType.fill( -1 );
+
+		for ( unsigned int type = 0; type < ECS_MAX_COMPONENT_TYPES; type++ )
+		{
+			if ( 0 != ( mask & ( ComponentMask( 1 ) << type ) ) )
+			{
+				archetype->_arrayOfType[type] = static_cast<int>( archetype->_types.size( ) );
+				archetype->_types.push_back( type );
+				archetype->_arrays.push_back( nullptr );
+			}
+		}
+
+		_archetypeList.push_back( archetype.get( ) );
+
+		return *archetype;
+	}
+
+	Entity Registry::AllocateEntity( )
+	{
+		Entity entity;
+
+		if ( !_freeIndices.empty( ) )
+		{
+			entity._index = _freeIndices.back( );
+			_freeIndices.pop_back( );
+		}
+		else
+		{
+			entity._index = static_cast<std::uint32_t>( _records.size( ) );
+			_records.emplace_back( );
+		}
+
+		entity._generation = _records[entity._index]._generation;
+		_entityCount++;
+
+		return entity;
+	}
+
+	unsigned int Registry::AddRow( Archetype &archetype, const Entity &entity )
+	{
+		const std::size_t row = archetype._entities.size( );
+
+		if ( row == archetype._capacity )
+		{
+			const std::size_t capacity = std::max<std::size_t>( ECS_ARCHETYPE_INITIAL_CAPACITY, archetype._capacity * 2 );
+
+			for ( std::size_t i = 0; i < archetype._types.size( ); i++ )
+			{
+				const ComponentInfo &info = GetComponentInfo( archetype._types[i] );
+				unsigned char *array = static_cast<unsigned char *>( ::operator new( capacity * info._size, std::align_val_t( info._alignment ) ) );
+
+				for ( std::size_t j = 0; j < row; j++ )
+				{
+					info._move( array + ( j * info._size ), archetype._arrays[i] + ( j * info._size ) );
+					info._destroy( archetype._arrays[i] + ( j * info._size ) );
+				}
+
+				if ( nullptr != archetype._arrays[i] )
+				{ ::operator delete( archetype._arrays[i], std::align_val_t( info._alignment ) ); }
+
+				archetype._arrays[i] = array;
+			}
+
+			archetype._capacity = capacity;
+		}
+
+		archetype._entities.push_back( entity );
+
+		Record &record = _records[entity._index];
+
+		record._archetype = &archetype;
+		record._row = static_cast<unsigned int>( row );
+
+		return record._row;
+	}
+
+	void Registry::RemoveRow( Archetype &archetype, const unsigned int &row )
+	{
+		const std::size_t last = archetype._entities.size( ) - 1;
+
+		for ( std::size_t i = 0; i < archetype._types.size( ); i++ )
+		{
+			const ComponentInfo &info = GetComponentInfo( archetype._types[i] );
+			unsigned char *removed = archetype._arrays[i] + ( row * info._size );
+
+			info._destroy( removed );
+
+			// Keep the rows packed by moving the last one into the gap
+			if ( row != last )
+			{
+				unsigned char *moved = archetype._arrays[i] + ( last * info._size );
+
+				info._move( removed, moved );
+				info._destroy( moved );
+			}
+		}
+
+		if ( row != last )
+		{
+			archetype._entities[row] = archetype._entities[last];
+			_records[archetype._entities[row]._index]._row = row;
+		}
+
+		archetype._entities.pop_back( );
+	}
+
+	unsigned int Registry::MoveEntity( const Entity &entity, Archetype &archetype )
+	{
+		Archetype &previous = *_records[entity._index]._archetype;
+		const unsigned int previousRow = _records[entity._index]._row;
+
+		if ( &previous == &archetype )
+		{ return previousRow; }
+
+		const unsigned int row = AddRow( archetype, entity );
+
+		for ( std::size_t i = 0; i < previous._types.size( ); i++ )
+		{
+			const unsigned int type = previous._types[i];
+
+			if ( -1 != archetype._arrayOfType[type] )
+			{ GetComponentInfo( type )._move( archetype.GetPointer( type, row ), previous.GetPointer( type, previousRow ) ); }
+		}
+
+		// Destroys the moved from components along with the ones the new archetype doesn't have
+		RemoveRow( previous, previousRow );
+
+		return row;
+	}
+
+	void Registry::FreeArrays( Archetype &archetype )
+	{
+		for ( std::size_t i = 0; i < archetype._types.size( ); i++ )
+		{
+			if ( nullptr != archetype._arrays[i] )
+			{ ::operator delete( archetype._arrays[i], std::align_val_t( GetComponentInfo( archetype._types[i] )._alignment ) ); }
+
+			archetype._arrays[i] = nullptr;
+		}
+
+		archetype._capacity = 0;
+	}
+}
@@ -0,0 +1,94 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	RenderSystem::RenderSystem( GameDataRef data ) : _data( data )
+	{ }
+
+	void RenderSystem::Draw( Registry &registry )
+	{
+		for ( auto &batch : _batches )
+		{ batch.second._vertexCount = 0; }
+
+		const glm::vec4 view = _data->renderQueue.GetViewBounds( );
+		const bool isCulling = 0.0f != view.z || 0.0f != view.w;
+
+		unsigned int culled = 0;
+
+		// Neighbouring entities usually share a layer and texture, so the last batch is checked before the map
+		std::pair<unsigned char, const sf::Texture *> lastKey( 0, nullptr );
+		Batch *lastBatch = nullptr;
+
+		registry.GetView<TransformComponent, SpriteComponent>( ).ForEach( [&]( const TransformComponent &transform, const SpriteComponent &sprite )
+		{
+			const float radians = glm::radians( transform._rotation );
+			const float cosine = std::cos( radians ), sine = std::sin( radians );
+
+			const glm::vec2 axisX = glm::vec2( cosine, sine ) * transform._scale.x;
+			const glm::vec2 axisY = glm::vec2( -sine, cosine ) * transform._scale.y;
+
+			const glm::vec2 size( sprite._textureRect.z, sprite._textureRect.w );
+			const glm::vec2 topLeft = transform._position - ( axisX * sprite._origin.x ) - ( axisY * sprite._origin.y );
+
+			const glm::vec2 corners[4] = { topLeft, topLeft + ( axisX * size.x ), topLeft + ( axisX * size.x ) + ( axisY * size.y ), topLeft + ( axisY * size.y ) };
+
+			if ( isCulling )
+			{
+				const glm::vec2 minimum = glm::min( glm::min( corners[0], corners[1] ), glm::min( corners[2], corners[3] ) );
+				const glm::vec2 maximum = glm::max( glm::max( corners[0], corners[1] ), glm::max( corners[2], corners[3] ) );
+
+				if ( maximum.x < view.x || minimum.x > view.x + view.z || maximum.y < view.y || minimum.y > view.y + view.w )
+				{
+					culled++;
+
+					return;
+				}
+			}
+
+			const std::pair<unsigned char, const sf::Texture *> key( sprite._layer, sprite._texture );
+
+			if ( nullptr == lastBatch || key != lastKey )
+			{
+				lastBatch = &_batches[key];
+				lastBatch->_texture = sprite._texture;
+				lastKey = key;
+			}
+
+			Batch &batch = *lastBatch;
+
+			if ( batch._vertices.size( ) < batch._vertexCount + 6 )
+			{ batch._vertices.resize( std::max<std::size_t>( 6, batch._vertices.size( ) * 2 ) ); }
+
+			const float left = static_cast<float>( sprite._textureRect.x ), top = static_cast<float>( sprite._textureRect.y );
+			const float right = left + size.x, bottom = top + size.y;
+			const sf::Color color = sprite._color.GetColor( );
+
+			const sf::Vertex quad[4] =
+			{
+				sf::Vertex( sf::Vector2f( corners[0].x, corners[0].y ), color, sf::Vector2f( left, top ) ),
+				sf::Vertex( sf::Vector2f( corners[1].x, corners[1].y ), color, sf::Vector2f( right, top ) ),
+				sf::Vertex( sf::Vector2f( corners[2].x, corners[2].y ), color, sf::Vector2f( right, bottom ) ),
+				sf::Vertex( sf::Vector2f( corners[3].x, corners[3].y ), color, sf::Vector2f( left, bottom ) )
+			};
+
+			sf::Vertex *vertices = &batch._vertices[batch._vertexCount];
+
+			vertices[0] = quad[0];
+			vertices[1] = quad[1];
+			vertices[2] = quad[2];
+			vertices[3] = quad[0];
+			vertices[4] = quad[2];
+			vertices[5] = quad[3];
+
+			batch._vertexCount += 6;
+		} );
+
+		_data->renderQueue.AddCulled( culled );
+
+		for ( const auto &batch : _batches )
+		{
+			if ( 0 != batch.second._vertexCount )
+			{ _data->renderQueue.SubmitTriangles( batch.second._vertices.data( ), batch.second._vertexCount, batch.second._texture, batch.first.first, 0.0f ); }
+		}
+	}
+}
@@ -0,0 +1,80 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	SystemScheduler::SystemScheduler( GameDataRef data ) : _data( data )
+	{
+		_isGraphDirty = false;
+		_registry = nullptr;
+		_dt = 0;
+	}
+
+	void SystemScheduler::AddSystem( const std::string &name, System system, const ComponentMask &reads, const ComponentMask &writes, const bool &isExclusive )
+	{
+		_systems.push_back( { name, std::move( system ), reads, writes, isExclusive } );
+		_isGraphDirty = true;
+	}
+
+	void SystemScheduler::RemoveSystem( const std::string &name )
+	{
+		auto isNamed = [&]( const Entry &entry ) { return entry._name == name; };
+
+		_systems.erase( std::remove_if( _systems.begin( ), _systems.end( ), isNamed ), _systems.end( ) );
+		_isGraphDirty = true;
+	}
+
+	void SystemScheduler::Clear( )
+	{
+		_systems.clear( );
+		_isGraphDirty = true;
+	}
+
+	void SystemScheduler::Run( Registry &registry, const float &dt )
+	{
+		if ( _systems.empty( ) )
+		{ return; }
+
+		if ( _isGraphDirty )
+		{ BuildGraph( ); }
+
+		_registry = &registry;
+		_dt = dt;
+
+		JobCounter counter;
+
+		_data->jobs.Run( _graph, counter );
+		_data->jobs.Wait( counter );
+	}
+
+	unsigned int SystemScheduler::GetSystemCount( ) const
+	{ return static_cast<unsigned int>( _systems.size( ) ); }
+
+	bool SystemScheduler::Conflicts( const Entry &a, const Entry &b )
+	{
+		if ( a._isExclusive || b._isExclusive )
+		{ return true; }
+
+		return 0 != ( a._writes & ( b._reads | b._writes ) ) || 0 != ( b._writes & a._reads );
+	}
+
+	void SystemScheduler::BuildGraph( )
+	{
+		_graph.Clear( );
+
+		for ( std::size_t i = 0; i < _systems.size( ); i++ )
+		{
+			std::vector<unsigned int> dependencies;
+
+			// Task indices match system indices as the tasks are added in order
+			for ( std::size_t j = 0; j < i; j++ )
+			{
+				if ( Conflicts( _systems[j], _systems[i] ) )
+				{ dependencies.push_back( static_cast<unsigned int>( j ) ); }
+			}
+
+			_graph.AddTask( [this, i]( ) { _systems[i]._system( *_registry, _dt ); }, dependencies );
+		}
+
+		_isGraphDirty = false;
+	}
+}
@@ -51,6 +51,8 @@ namespace Sonar
 		_isHoverEnabled = DEFAULT_BUTTON_HOVER_STATUS;
 		_isClickEnabled = DEFAULT_BUTTON_CLICK_STATUS;
 
+		_lastMouseState = MOUSE_STATE::NOT_INTERACTING;
+
 		SetButtonStyle( _defaultStyle, false );
 	}
 
@@ -195,6 +197,8 @@ namespace Sonar
 
 		if ( updateDefaultStyle )
 		{ UpdateDefaultStyle( ); }
+
+		ReportVisualChange( );
 	}
 
 	const std::string &Button::GetText( ) const
@@ -800,6 +804,14 @@ namespace Sonar
 		_label->Update( dt );
 		_background->Update( dt );
 
+		// Styles are reapplied every frame, only a change of state changes what is drawn
+		if ( mouseState != _lastMouseState )
+		{
+			_lastMouseState = mouseState;
+
+			ReportVisualChange( );
+		}
+
 		return mouseState;
 	}
 
@@ -339,6 +339,28 @@ namespace Sonar
 		{ button->SetTheme( theme ); }
 	}
 
+	bool ButtonGroup::HasVisualChanged( ) const
+	{
+		if ( MenuComponent::HasVisualChanged( ) )
+		{ return true; }
+
+		for ( const auto &button : _buttons )
+		{
+			if ( button->HasVisualChanged( ) )
+			{ return true; }
+		}
+
+		return false;
+	}
+
+	void ButtonGroup::ClearVisualChange( )
+	{
+		MenuComponent::ClearVisualChange( );
+
+		for ( const auto &button : _buttons )
+		{ button->ClearVisualChange( ); }
+	}
+
 	void ButtonGroup::MoveUp( const bool &cycleDown, const unsigned int &moveAmount )
 	{
 		if ( _currentIndex - moveAmount >= 0 && _currentIndex - moveAmount < _buttons.size( ) )
@@ -577,6 +599,8 @@ namespace Sonar
 
 	void ButtonGroup::UpdateButtons( )
 	{
+		ReportVisualChange( );
+
 		for ( unsigned int i = 0; i < _buttons.size( ); i++ )
 		{
 			if ( i == _currentIndex )
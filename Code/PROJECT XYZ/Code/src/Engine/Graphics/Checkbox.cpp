@@ -28,6 +28,7 @@ namespace Sonar
 		_isSelected = DEFAULT_CHECKBOX_IS_CLICKED_STATUS;
 
 		_isMouseDown = false;
+		_wasMouseOver = false;
 	}
 
 	Checkbox::~Checkbox( ) { }
@@ -45,6 +46,9 @@ namespace Sonar
 		_outerLayer->Update( dt );
 		_insideLayer->Update( dt );
 
+		const bool wasSelected = _isSelected;
+		const bool isMouseOver = _outerLayer->IsMouseOver( );
+
 		if ( _outerLayer->IsClicked( _buttonToClick ) )
 		{
 			if ( !_isMouseDown )
@@ -68,6 +72,11 @@ namespace Sonar
 
 			_isMouseDown = false;
 		}
+
+		if ( wasSelected != _isSelected || isMouseOver != _wasMouseOver )
+		{ ReportVisualChange( ); }
+
+		_wasMouseOver = isMouseOver;
 	}
 
 	void Checkbox::PollInput( const float &dt, const Event &event ) { }
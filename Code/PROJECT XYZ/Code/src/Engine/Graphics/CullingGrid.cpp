@@ -0,0 +1,163 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	CullingGrid::CullingGrid( GameDataRef data, const float &cellSize ) : _data( data )
+	{
+		_cellSize = std::max( 1.0f, cellSize );
+		_objectCount = 0;
+		_nextOrder = 0;
+	}
+
+	CullingGrid::~CullingGrid( )
+	{ Clear( ); }
+
+	void CullingGrid::Insert( Drawable &drawable )
+	{
+		if ( this == drawable._cullingGrid )
+		{ return; }
+
+		if ( nullptr != drawable._cullingGrid )
+		{ drawable._cullingGrid->Remove( drawable ); }
+
+		drawable._cullingGrid = this;
+		drawable._cullingOrder = _nextOrder++;
+		_objectCount++;
+
+		AddToCell( drawable, drawable.GetDrawBounds( ) );
+	}
+
+	void CullingGrid::Remove( Drawable &drawable )
+	{
+		if ( this != drawable._cullingGrid )
+		{ return; }
+
+		// Copies of a drawable point at the grid without being in it
+		if ( RemoveFromCell( drawable ) )
+		{ _objectCount--; }
+
+		drawable._cullingGrid = nullptr;
+	}
+
+	void CullingGrid::Update( Drawable &drawable )
+	{
+		const glm::vec4 bounds = drawable.GetDrawBounds( );
+		const bool isOversized = IsOversized( bounds );
+
+		// Nothing to move while it stays in the oversized list or in the same cell
+		if ( isOversized == drawable._isCullingOversized && ( isOversized || GetCenterCellKey( bounds ) == drawable._cullingCell ) )
+		{ return; }
+
+		if ( !RemoveFromCell( drawable ) )
+		{ return; }
+
+		AddToCell( drawable, bounds );
+	}
+
+	void CullingGrid::Clear( )
+	{
+		for ( auto &cell : _cells )
+		{
+			for ( auto &drawable : cell.second )
+			{ drawable->_cullingGrid = nullptr; }
+		}
+
+		for ( auto &drawable : _oversized )
+		{ drawable->_cullingGrid = nullptr; }
+
+		_cells.clear( );
+		_oversized.clear( );
+		_objectCount = 0;
+	}
+
+	void CullingGrid::Draw( )
+	{
+		const std::vector<Drawable *> visible = Query( _data->renderQueue.GetViewBounds( ) );
+
+		// Each one still gets the exact bounds test, the grid only rules out whole cells
+		for ( auto &drawable : visible )
+		{ drawable->Draw( ); }
+
+		_data->renderQueue.AddCulled( _objectCount - visible.size( ) );
+	}
+
+	std::vector<Drawable *> CullingGrid::Query( const glm::vec4 &bounds ) const
+	{
+		std::vector<Drawable *> drawables( _oversized.begin( ), _oversized.end( ) );
+
+		// Objects in cells are at most half a cell wide or tall, so growing the area by that finds the ones overhanging their cell
+		const float looseness = _cellSize * 0.5f;
+
+		const glm::ivec2 first = SpatialHash::GetCell( glm::vec2( bounds.x - looseness, bounds.y - looseness ), _cellSize );
+		const glm::ivec2 last = SpatialHash::GetCell( glm::vec2( bounds.x + bounds.z + looseness, bounds.y + bounds.w + looseness ), _cellSize );
+
+		SpatialHash::ForEachCell( _cells, glm::ivec4( first, last ), [&]( const std::vector<Drawable *> &cell )
+		{ drawables.insert( drawables.end( ), cell.begin( ), cell.end( ) ); } );
+
+		// Cells are walked in no particular order, put the objects back in the order they were added so overlapping objects draw the same as before
+		std::sort( drawables.begin( ), drawables.end( ), []( const Drawable *a, const Drawable *b ) { return a->_cullingOrder < b->_cullingOrder; } );
+
+		return drawables;
+	}
+
+	unsigned int CullingGrid::GetObjectCount( ) const
+	{ return _objectCount; }
+
+	std::int64_t CullingGrid::GetCenterCellKey( const glm::vec4 &bounds ) const
+	{
+		const glm::ivec2 cell = SpatialHash::GetCell( glm::vec2( bounds.x + ( bounds.z * 0.5f ), bounds.y + ( bounds.w * 0.5f ) ), _cellSize );
+
+		return SpatialHash::GetCellKey( cell.x, cell.y );
+	}
+
+	bool CullingGrid::IsOversized( const glm::vec4 &bounds ) const
+	{ return std::max( bounds.z, bounds.w ) > _cellSize; }
+
+	void CullingGrid::AddToCell( Drawable &drawable, const glm::vec4 &bounds )
+	{
+		drawable._isCullingOversized = IsOversized( bounds );
+
+		if ( drawable._isCullingOversized )
+		{
+			_oversized.push_back( &drawable );
+
+			return;
+		}
+
+		drawable._cullingCell = GetCenterCellKey( bounds );
+		_cells[drawable._cullingCell].push_back( &drawable );
+	}
+
+	bool CullingGrid::RemoveFromCell( Drawable &drawable )
+	{
+		if ( drawable._isCullingOversized )
+		{
+			auto found = std::find( _oversized.begin( ), _oversized.end( ), &drawable );
+
+			if ( _oversized.end( ) == found )
+			{ return false; }
+
+			_oversized.erase( found );
+
+			return true;
+		}
+
+		auto cell = _cells.find( drawable._cullingCell );
+
+		if ( _cells.end( ) == cell )
+		{ return false; }
+
+		auto &drawables = cell->second;
+		auto found = std::find( drawables.begin( ), drawables.end( ), &drawable );
+
+		if ( drawables.end( ) == found )
+		{ return false; }
+
+		drawables.erase( found );
+
+		if ( drawables.empty( ) )
+		{ _cells.erase( cell ); }
+
+		return true;
+	}
+}
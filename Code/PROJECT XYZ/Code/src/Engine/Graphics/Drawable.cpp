@@ -19,40 +19,102 @@ namespace Sonar
         _pulseCounter = 0;
     }
 
-    Drawable::~Drawable( ) { }
+    Drawable::Drawable( const Drawable &drawable ) : _data( drawable._data )
+    { *this = drawable; }
+
+    Drawable &Drawable::operator=( const Drawable &drawable )
+    {
+		if ( this == &drawable )
+		{ return *this; }
+
+		// The grid and world pointers aren't copied, they hold the original and would dangle in the copy once it is gone
+		_object = drawable._object;
+		_data = drawable._data;
+		_isPulsing = drawable._isPulsing;
+		_layer = drawable._layer;
+		_depth = drawable._depth;
+		_position = drawable._position;
+		_size = drawable._size;
+		_color = drawable._color;
+		_borderColor = drawable._borderColor;
+		_borderThickness = drawable._borderThickness;
+		_rotation = drawable._rotation;
+		_scale = drawable._scale;
+		_pivot = drawable._pivot;
+		_initialPulseScale = drawable._initialPulseScale;
+		_endPulseScale = drawable._endPulseScale;
+		_pulseAmount = drawable._pulseAmount;
+		_pulseCounter = drawable._pulseCounter;
+		_timeBetweenPulses = drawable._timeBetweenPulses;
+		_clock = drawable._clock;
+		_body = drawable._body;
+
+		OnTransformChanged( );
+
+		return *this;
+	}
+
+    Drawable::~Drawable( )
+	{
+		if ( nullptr != _cullingGrid )
+		{ _cullingGrid->Remove( *this ); }
+
+		if ( nullptr != _collisionWorld )
+		{ _collisionWorld->Remove( *this ); }
+
+		if ( nullptr != _body )
+		{ _data->physics.Detach( *this ); }
+	}
 
     void Drawable::Draw( )
     {
-		// Check if the object is within the visible window
-		// If not cull it
-		if ( _position.x + ( _size.x * _scale[0] ) < 0 // Check if it's beyond the left boundary
-			|| _position.x > _data->window.GetSize( ).x // Check if it's beyond the right boundary
-			|| _position.y + ( _size.y * _scale[1] ) < 0 // Check if it's beyond the top boundary
-			|| _position.y > _data->window.GetSize( ).y // Check if it's beyond the bottom boundary
-			)
-		{
-			//std::cout << _position.x << ":" << _position.y << "   -   " << _size.x << ":" << _size.y << "CULLING" << std::endl;
-			return;
-		}
-		sf::Window w;
+		// Cull the object if it is outside of the current view
+		if ( !_data->renderQueue.IsVisible( GetDrawBounds( ) ) )
+		{ return; }
 
-		_data->window.GetSFMLWindowObject( ).draw( *_object );
+		_data->renderQueue.Submit( *_object, _layer, _depth );
 	}
 
+	void Drawable::SetLayer( const unsigned char &layer )
+	{ _layer = layer; }
+
+	unsigned char Drawable::GetLayer( ) const
+	{ return _layer; }
+
+	void Drawable::SetDepth( const float &depth )
+	{ _depth = depth; }
+
+	float Drawable::GetDepth( ) const
+	{ return _depth; }
+
 	void Drawable::SetPosition( const glm::vec2 &position )
-	{ _position = position; }
+	{
+		_position = position;
+
+		OnTransformChanged( );
+	}
 
     void Drawable::SetPosition( const float &x, const float &y )
     {
         _position.x = x;
         _position.y = y;
+
+        OnTransformChanged( );
     }
 
 	void Drawable::SetPositionX( const float &x )
-    { _position.x = x; }
+    {
+        _position.x = x;
+
+        OnTransformChanged( );
+    }
 
     void Drawable::SetPositionY( const float &y )
-    { _position.y = y; }
+    {
+        _position.y = y;
+
+        OnTransformChanged( );
+    }
 
     float Drawable::GetPositionX( const OBJECT_POINTS &point ) const
     { return GetPosition( point ).x; }
@@ -88,19 +150,33 @@ namespace Sonar
 	}
 
 	void Drawable::SetSize( const glm::vec2 &size )
-	{ _size = size; }
+	{
+		_size = size;
+
+		OnTransformChanged( );
+	}
 
     void Drawable::SetSize( const float &width, const float &height )
     {
         _size.x = width;
         _size.y = height;
+
+        OnTransformChanged( );
     }
 
 	void Drawable::SetWidth( const float &width )
-    { _size.x = width; }
+    {
+        _size.x = width;
+
+        OnTransformChanged( );
+    }
 
     void Drawable::SetHeight( const float &height )
-    { _size.y = height; }
+    {
+        _size.y = height;
+
+        OnTransformChanged( );
+    }
     
     float Drawable::GetWidth( ) const
     { return _size.x; }
@@ -118,7 +194,12 @@ namespace Sonar
     { _borderColor = color; }
 
     void Drawable::SetBorderThickness( const float &thickness )
-    { _borderThickness = thickness; }
+    {
+        _borderThickness = thickness;
+
+        // Outlines count towards the bounds
+        _isGlobalBoundsDirty = true;
+    }
 
     Color Drawable::GetInsideColor( ) const
     { return _color; }
@@ -130,25 +211,47 @@ namespace Sonar
     { return _borderThickness; }
 
 	void Drawable::Move( const glm::vec2 &offset )
-	{ _position += offset; }
+	{
+		_position += offset;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::Move( const float &x, const float &y )
     {
         _position.x += x;
         _position.y += y;
+
+        OnTransformChanged( );
     }
 
 	void Drawable::MoveX( const float &x )
-    { _position.x += x; }
+    {
+        _position.x += x;
+
+        OnTransformChanged( );
+    }
 
     void Drawable::MoveY( const float &y )
-    { _position.y += y; }
+    {
+        _position.y += y;
+
+        OnTransformChanged( );
+    }
 
 	void Drawable::SetRotation( const float &angle )
-	{ _rotation = angle; }
+	{
+		_rotation = angle;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::Rotate( const float &angle )
-	{ _rotation += angle; }
+	{
+		_rotation += angle;
+
+		OnTransformChanged( );
+	}
 
 	float Drawable::GetRotation( ) const
     { return _rotation; }
@@ -157,31 +260,59 @@ namespace Sonar
 	{
         _scale.x = xScale;
         _scale.y = yScale;
+
+        OnTransformChanged( );
 	}
 
 	void Drawable::SetScale( const glm::vec2 &scale )
-	{ _scale = scale; }
+	{
+		_scale = scale;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::SetScaleX( const float &xScale )
-	{ _scale.x = xScale; }
+	{
+		_scale.x = xScale;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::SetScaleY( const float &yScale )
-	{ _scale.y = yScale; }
+	{
+		_scale.y = yScale;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::Scale( const glm::vec2 &scale )
-	{ _scale *= scale; }
+	{
+		_scale *= scale;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::Scale( const float &xScale, const float &yScale )
 	{
 		_scale.x *= xScale;
 		_scale.y *= yScale;
+
+		OnTransformChanged( );
 	}
 
 	void Drawable::ScaleX( const float &xScale )
-	{ _scale.x *= xScale; }
+	{
+		_scale.x *= xScale;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::ScaleY( const float &yScale )
-	{ _scale.y *= yScale; }
+	{
+		_scale.y *= yScale;
+
+		OnTransformChanged( );
+	}
 
 	glm::vec2 Drawable::GetScale( ) const
 	{ return _scale; }
@@ -196,10 +327,16 @@ namespace Sonar
 	{
         _pivot[0] = xPoint;
         _pivot[1] = yPoint;
+
+        OnTransformChanged( );
 	}
 
 	void Drawable::SetPivot( const glm::vec2 &pivot )
-	{ _pivot = pivot; }
+	{
+		_pivot = pivot;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::SetPivot( const OBJECT_POINTS &pivot )
 	{
@@ -233,10 +370,18 @@ namespace Sonar
 	}
 
 	void Drawable::SetPivotX( const float &xPoint )
-	{ _pivot[0] = xPoint; }
+	{
+		_pivot[0] = xPoint;
+
+		OnTransformChanged( );
+	}
 
 	void Drawable::SetPivotY( const float &yPoint )
-    { _pivot[1] = yPoint; }
+    {
+        _pivot[1] = yPoint;
+
+        OnTransformChanged( );
+    }
 
 	glm::vec2 Drawable::GetPivot( ) const
 	{ return _pivot; }
@@ -254,6 +399,7 @@ namespace Sonar
         _timeBetweenPulses = timeBetweenPulses;
 
         _pulseAmount = pulseAmount;
+        _isPulsing = true;
 
 		_clock.Reset( );
 	}
@@ -269,14 +415,21 @@ namespace Sonar
 
 	void Drawable::StopPulse( )
 	{
+		_isPulsing = false;
 		_pulseCounter = 0;
 		_endPulseScale = _initialPulseScale;
 
 		SetScale( _initialPulseScale );
 	}
 
+	bool Drawable::IsPulsing( ) const
+	{ return _isPulsing; }
+
 	void Drawable::Update( const float &dt )
 	{
+		if ( !_isPulsing )
+		{ return; }
+
 		if ( ( _pulseAmount > 0 && _pulseCounter < _pulseAmount ) || 0 == _pulseAmount )
 		{
 			if ( _clock.GetElapsedTime( ).AsMicroseconds( ) > _timeBetweenPulses.AsMicroseconds( ) )
@@ -315,7 +468,9 @@ namespace Sonar
 					SetScale( interimPulseX, interimPulseY );
 				}
 			}
-        }
+		}
+		else
+		{ _isPulsing = false; }
 	}
 
 	bool Drawable::IsClicked( const Mouse::Button &button ) const
@@ -354,40 +509,105 @@ namespace Sonar
 
 	bool Drawable::CircleCollision( const Drawable &object ) const
 	{
-		sf::FloatRect shape1 = _globalBounds; // This object
-		sf::FloatRect shape2 = sf::FloatRect( object.GetGlobalBounds( )[0], object.GetGlobalBounds( )[1], object.GetGlobalBounds( )[2], object.GetGlobalBounds( )[3] ); // Passed in object
+		const glm::vec4 shape1 = GetGlobalBounds( ); // This object
+		const glm::vec4 shape2 = object.GetGlobalBounds( ); // Passed in object
 
-		float dx = ( _position[0] + ( shape1.width / 2 ) ) - ( object.GetPositionX( ) + ( shape2.width / 2 ) );
-		float dy = ( _position[1] + ( shape1.height / 2 ) ) - ( object.GetPositionY( ) + ( shape2.height / 2 ) );
-		float distance = std::sqrt( ( dx * dx ) + ( dy * dy ) );
+		const float dx = ( _position[0] + ( shape1[2] * 0.5f ) ) - ( object.GetPositionX( ) + ( shape2[2] * 0.5f ) );
+		const float dy = ( _position[1] + ( shape1[3] * 0.5f ) ) - ( object.GetPositionY( ) + ( shape2[3] * 0.5f ) );
+		const float radii = ( shape1[2] + shape2[2] ) * 0.5f;
 
-		if ( distance <= ( shape1.width / 2 ) + ( shape2.width / 2 ) )
-		{ return true; }
-		else
-		{ return false; }
+		// Compared squared, no square root needed
+		return ( dx * dx ) + ( dy * dy ) <= radii * radii;
 	}
 
 	glm::vec4 Drawable::GetGlobalBounds( ) const
-	{ return glm::vec4( _globalBounds.left, _globalBounds.top, _globalBounds.width, _globalBounds.height); }
+	{
+		if ( _isGlobalBoundsDirty )
+		{
+			_globalBounds = CalculateGlobalBounds( );
+			_isGlobalBoundsDirty = false;
+		}
+
+		return glm::vec4( _globalBounds.left, _globalBounds.top, _globalBounds.width, _globalBounds.height );
+	}
+
+	sf::FloatRect Drawable::CalculateGlobalBounds( ) const
+	{ return sf::FloatRect( _position.x, _position.y, _size.x * _scale.x, _size.y * _scale.y ); }
 
 	sf::Drawable *Drawable::GetSFMLDrawable( ) const
 	{ return _object; }
 
-	void Drawable::SetupPhysics( )
+	b2Body *Drawable::SetupPhysics( const b2BodyType &type, const float &density, const float &friction )
 	{
-		float SCALE = 32.0f;
+		b2BodyDef bodyDef;
+		bodyDef.type = type;
+
+		b2Body *body = _data->physics.Attach( *this, bodyDef );
+
+		// The body sits on the pivot, so the box is offset to cover the object around it
+		const glm::vec2 size = _size * glm::abs( _scale );
+		const glm::vec2 center = ( ( _size * 0.5f ) - _pivot ) * _scale;
+
+		b2PolygonShape shape;
+		shape.SetAsBox( Physics::ToMeters( size.x * 0.5f ), Physics::ToMeters( size.y * 0.5f ), Physics::ToMeters( center ), 0.0f );
 
-		BodyDef.position = b2Vec2( _position[0] / SCALE, _position[1] / SCALE );
-		BodyDef.type = b2_dynamicBody;
-		b2Body *Body = _data->world->CreateBody( &BodyDef );
+		b2FixtureDef fixtureDef;
+		fixtureDef.density = density;
+		fixtureDef.friction = friction;
+		fixtureDef.shape = &shape;
+		body->CreateFixture( &fixtureDef );
 
-		b2PolygonShape Shape;
-		Shape.SetAsBox( ( _size[0] * 0.5f ) / SCALE, ( _size[1] * 0.5f ) / SCALE );
-		b2FixtureDef FixtureDef;
-		FixtureDef.density = 1.0f;
-		FixtureDef.friction = 0.7f;
-		FixtureDef.shape = &Shape;
-		Body->CreateFixture( &FixtureDef );
+		return body;
 	}
-}
 
+	void Drawable::RemovePhysics( )
+	{ _data->physics.Detach( *this ); }
+
+	b2Body *Drawable::GetBody( ) const
+	{ return _body; }
+
+	glm::vec4 Drawable::GetDrawBounds( ) const
+	{
+		const glm::vec2 scale = glm::abs( _scale );
+		const glm::vec2 origin = _position - ( _pivot * _scale );
+
+		if ( 0.0f == std::fmod( _rotation, 360.0f ) )
+		{
+			const glm::vec2 size = _size * scale;
+
+			return glm::vec4( std::min( origin.x, origin.x + ( _size.x * _scale.x ) ), std::min( origin.y, origin.y + ( _size.y * _scale.y ) ), size.x, size.y );
+		}
+
+		// Rotated objects are bounded by the circle their furthest corner sweeps around the pivot
+		const glm::vec2 furthest = glm::max( glm::abs( _pivot ), glm::abs( _size - _pivot ) ) * scale;
+		const float radius = glm::length( furthest );
+
+		return glm::vec4( _position.x - radius, _position.y - radius, radius * 2.0f, radius * 2.0f );
+	}
+
+	void Drawable::OnTransformChanged( )
+	{
+		_isGlobalBoundsDirty = true;
+
+		if ( nullptr != _cullingGrid )
+		{ _cullingGrid->Update( *this ); }
+
+		if ( nullptr != _collisionWorld )
+		{ _collisionWorld->Update( *this ); }
+	}
+
+	void Drawable::SetPhysicsTransform( const glm::vec2 &position, const float &rotation )
+	{
+		_position = position;
+		_rotation = rotation;
+
+		// Every child draws an SFML transformable, children hide SetPosition and SetRotation rather than override them so the object is moved directly
+		if ( sf::Transformable *transformable = dynamic_cast<sf::Transformable *>( _object ) )
+		{
+			transformable->setPosition( position.x, position.y );
+			transformable->setRotation( rotation );
+		}
+
+		OnTransformChanged( );
+	}
+}
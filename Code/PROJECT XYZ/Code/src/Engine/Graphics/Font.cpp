@@ -2,7 +2,8 @@
 
 namespace Sonar
 {
-	Font::Font( ) { }
+	Font::Font( )
+	{ _font = std::make_shared<sf::Font>( ); }
 
 	Font::Font( const std::string &filepath )
 	{ SetFontFile( filepath ); }
@@ -13,22 +14,31 @@ namespace Sonar
 	{
 		_filePath = filepath;
 
-		_font.loadFromFile( _filePath );
+		_font = std::make_shared<sf::Font>( );
+		_font->loadFromFile( _filePath );
+	}
+
+	void Font::SetFontData( const std::string &filepath, const void *data, const std::size_t &size )
+	{
+		_filePath = filepath;
+
+		_font = std::make_shared<sf::Font>( );
+		_font->loadFromMemory( data, size );
 	}
 
 	std::string Font::GetFontFilePath( ) const
 	{ return _filePath; }
 
 	float Font::GetLineSpacing( const unsigned int &characterSize ) const
-	{ return _font.getLineSpacing( characterSize ); }
+	{ return _font->getLineSpacing( characterSize ); }
 
 	float Font::GetUnderlinePosition( const unsigned int &characterSize ) const
-	{ return _font.getUnderlinePosition( characterSize ); }
+	{ return _font->getUnderlinePosition( characterSize ); }
 
 	float Font::GetUnderlineThickness( const unsigned int &characterSize ) const
-	{ return _font.getUnderlineThickness( characterSize ); }
+	{ return _font->getUnderlineThickness( characterSize ); }
 
 	const sf::Font &Font::GetSFMLFont( ) const
-	{ return _font; }
+	{ return *_font; }
 }
 
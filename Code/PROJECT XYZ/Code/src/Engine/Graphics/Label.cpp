@@ -22,7 +22,7 @@ namespace Sonar
 
 		SetText( _string );
 
-		_globalBounds = _text.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 
 		isBold = isItalic = isUnderlined = isStrikeThrough = STYLE::Regular;
 	}
@@ -53,12 +53,7 @@ namespace Sonar
 	Label::~Label( ) { }
 
 	void Label::SetFontFilePath( const std::string &filepath )
-	{
-		_filePath = filepath;
-
-		_font.SetFontFile( _filePath );
-		SetFont( _font );
-	}
+	{ SetFont( _data->assets.GetFontFromFile( filepath ) ); }
 
 	std::string Label::GetFontFilePath( ) const
 	{ return _filePath; }
@@ -79,7 +74,7 @@ namespace Sonar
 	{
 		Drawable::SetPosition( position );
 		_text.setPosition( position.x, position.y );
-		_globalBounds = _text.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Label::SetPosition( const float &x, const float &y )
@@ -123,7 +118,7 @@ namespace Sonar
 	{
 		Drawable::Move( offset );
 		_text.move( offset.x, offset.y );
-		_globalBounds = _text.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Label::Move( const float &x, const float &y )
@@ -139,7 +134,7 @@ namespace Sonar
 	{
 		Drawable::SetRotation( angle );
 		_text.setRotation( angle );
-		_globalBounds = _text.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Label::Rotate( const float &angle )
@@ -152,7 +147,7 @@ namespace Sonar
 	{
 		Drawable::SetScale( scale[0], scale[1] );
 		_text.setScale( scale[0], scale[1] );
-		_globalBounds = _text.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 	
 	void Label::SetScale( const float &xScale, const float &yScale )
@@ -180,7 +175,7 @@ namespace Sonar
 	{
 		Drawable::SetPivot( pivot );
 		_text.setOrigin( pivot[0], pivot[1] );
-		_globalBounds = _text.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Label::SetPivot( const float &xPoint, const float &yPoint )
@@ -221,7 +216,7 @@ namespace Sonar
 				break;
 		}
 
-		_globalBounds = _text.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Label::SetPivotX( const float &xPoint )
@@ -232,6 +227,10 @@ namespace Sonar
 
 	void Label::Update( const float &dt )
 	{
+		// Only a pulse changes anything here, idle objects cost nothing per frame
+		if ( !IsPulsing( ) )
+		{ return; }
+
 		Drawable::Update( dt );
 
 		SetScale( Drawable::GetScale( ) );
@@ -241,7 +240,10 @@ namespace Sonar
 	{ return glm::vec4( _text.getLocalBounds( ).left, _text.getLocalBounds( ).top, _text.getLocalBounds( ).width, _text.getLocalBounds( ).height ); }
 
 	glm::vec4 Label::GetGlobalBounds( ) const
-	{ return glm::vec4( _text.getGlobalBounds( ).left, _text.getGlobalBounds( ).top, _text.getGlobalBounds( ).width, _text.getGlobalBounds( ).height ); }
+	{ return Drawable::GetGlobalBounds( ); }
+
+	sf::FloatRect Label::CalculateGlobalBounds( ) const
+	{ return _text.getGlobalBounds( ); }
 
 	void Label::SetText( const std::string &string )
 	{
@@ -250,6 +252,8 @@ namespace Sonar
 
 		SetPosition( _text.getPosition( ).x, _text.getPosition( ).y );
 		SetSize( _text.getLocalBounds( ).width, _text.getLocalBounds( ).height );
+
+		ReportVisualChange( );
 	}
 
 	void Label::SetFont( const Font &font )
@@ -274,10 +278,16 @@ namespace Sonar
 	{ return _text.getCharacterSize( ); }
 
 	void Label::SetLineSpacing( const float &spacingFactor )
-	{ _text.setLineSpacing( spacingFactor ); }
+	{
+		_text.setLineSpacing( spacingFactor );
+		_isGlobalBoundsDirty = true;
+	}
 
 	void Label::SetLetterSpacing( const float &spacingFactor )
-	{ _text.setLetterSpacing( spacingFactor ); }
+	{
+		_text.setLetterSpacing( spacingFactor );
+		_isGlobalBoundsDirty = true;
+	}
 
 	void Label::SetStyle( const STYLE &style, const bool &isActivated )
 	{
@@ -323,10 +333,14 @@ namespace Sonar
 		}
 		
 		_text.setStyle( isBold | isItalic | isUnderlined | isStrikeThrough );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Label::SetStyle( const unsigned int &style )
-	{ _text.setStyle( style ); }
+	{
+		_text.setStyle( style );
+		_isGlobalBoundsDirty = true;
+	}
 
 	const std::string &Label::GetText( ) const
 	{ return _string; }
@@ -3,14 +3,57 @@
 namespace Sonar
 {
 	Menu::Menu( GameDataRef data ) : _data( data )
-	{ _theme = DEFAULT_MENU_THEME; }
+	{
+		_theme = DEFAULT_MENU_THEME;
+
+		_isCachingEnabled = DEFAULT_IS_MENU_CACHING_ENABLED;
+		_isCacheDirty = true;
+	}
 
 	Menu::~Menu( ) { }
 
 	void Menu::Draw( )
 	{
+		if ( !_isCachingEnabled )
+		{
+			for ( const auto &component : _menuComponents )
+			{ component->Draw( ); }
+
+			return;
+		}
+
+		const glm::uvec2 size = _data->window.GetSize( );
+
+		if ( size.x != _cache.getSize( ).x || size.y != _cache.getSize( ).y )
+		{
+			_cache.create( size.x, size.y );
+			_cacheSprite.setTexture( _cache.getTexture( ), true );
+
+			_isCacheDirty = true;
+		}
+
+		const sf::View &view = _data->renderQueue.GetView( );
+
+		// The components are drawn in world space, moving the view moves them across the screen
+		if ( view.getCenter( ) != _cacheView.getCenter( ) || view.getSize( ) != _cacheView.getSize( ) || view.getRotation( ) != _cacheView.getRotation( ) )
+		{ _isCacheDirty = true; }
+
+		bool hasChanged = _isCacheDirty;
+
 		for ( const auto &component : _menuComponents )
-		{ component->Draw( ); }
+		{ hasChanged = hasChanged || component->HasVisualChanged( ); }
+
+		if ( hasChanged )
+		{ RedrawCache( ); }
+
+		// Stretched over the view it was drawn with so it lines up with whatever is drawn around it
+		_cacheSprite.setOrigin( size.x * 0.5f, size.y * 0.5f );
+		_cacheSprite.setPosition( view.getCenter( ) );
+		_cacheSprite.setRotation( view.getRotation( ) );
+		_cacheSprite.setScale( view.getSize( ).x / size.x, view.getSize( ).y / size.y );
+
+		// The cache holds colours already multiplied by their alpha
+		_data->renderQueue.Submit( _cacheSprite, sf::BlendMode( sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha ) );
 	}
 
 	void Menu::Update( const float &dt )
@@ -31,6 +74,8 @@ namespace Sonar
 		{ component->SetTheme( _theme ); }
 
 		_menuComponents.push_back( component );
+
+		_isCacheDirty = true;
 	}
 
 	void Menu::RemoveComponent( std::shared_ptr<MenuComponent> component )
@@ -44,25 +89,39 @@ namespace Sonar
 			newMenuComponentsVector.pop_back( );
 
 			_menuComponents = newMenuComponentsVector;
+
+			_isCacheDirty = true;
 		}
 	}
 
 	void Menu::RemoveComponent( const unsigned int &index )
 	{
 		if ( index < _menuComponents.size( ) )
-		{ _menuComponents.erase( _menuComponents.begin( ) + index ); }
+		{
+			_menuComponents.erase( _menuComponents.begin( ) + index );
+
+			_isCacheDirty = true;
+		}
 	}
 
 	void Menu::RemoveFirstComponent( )
 	{
 		if ( 0 < _menuComponents.size( ) )
-		{ _menuComponents.erase( _menuComponents.begin( ) ); }
+		{
+			_menuComponents.erase( _menuComponents.begin( ) );
+
+			_isCacheDirty = true;
+		}
 	}
 
 	void Menu::RemoveLastComponent( )
 	{
 		if ( _menuComponents.size( ) > 0 )
-		{ _menuComponents.erase( _menuComponents.end( ) - 1 ); }
+		{
+			_menuComponents.erase( _menuComponents.end( ) - 1 );
+
+			_isCacheDirty = true;
+		}
 	}
 
 	void Menu::SetTheme( const MenuComponent::Theme &theme )
@@ -76,9 +135,52 @@ namespace Sonar
 	{
 		for ( auto component : _menuComponents )
 		{ component->SetTheme( _theme ); }
+
+		_isCacheDirty = true;
 	}
 
 	const Sonar::MenuComponent::Theme &Menu::GetTheme( ) const
 	{ return _theme; }
-}
 
+	void Menu::EnableCaching( )
+	{
+		_isCachingEnabled = true;
+		_isCacheDirty = true;
+	}
+
+	void Menu::DisableCaching( )
+	{ _isCachingEnabled = false; }
+
+	const bool &Menu::IsCachingEnabled( ) const
+	{ return _isCachingEnabled; }
+
+	void Menu::Invalidate( )
+	{ _isCacheDirty = true; }
+
+	void Menu::RedrawCache( )
+	{
+		sf::RenderTarget &target = _data->window.GetRenderTarget( );
+
+		_cacheView = _data->renderQueue.GetView( );
+
+		sf::View view = _cacheView;
+		view.setViewport( sf::FloatRect( 0, 0, 1, 1 ) );
+
+		// Anything already queued is drawn to the window first so the order is kept
+		_data->renderQueue.SetTarget( &_cache );
+
+		_cache.setView( view );
+		_cache.clear( sf::Color::Transparent );
+
+		for ( const auto &component : _menuComponents )
+		{
+			component->Draw( );
+			component->ClearVisualChange( );
+		}
+
+		_data->renderQueue.SetTarget( &target );
+		_cache.display( );
+
+		_isCacheDirty = false;
+	}
+}
\ No newline at end of file
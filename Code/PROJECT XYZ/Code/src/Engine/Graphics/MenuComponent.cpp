@@ -5,5 +5,14 @@ namespace Sonar
 	MenuComponent::MenuComponent( ) { }
 
 	MenuComponent::~MenuComponent( ) { }
+
+	bool MenuComponent::HasVisualChanged( ) const
+	{ return _hasVisualChanged; }
+
+	void MenuComponent::ClearVisualChange( )
+	{ _hasVisualChanged = false; }
+
+	void MenuComponent::ReportVisualChange( )
+	{ _hasVisualChanged = true; }
 }
 
@@ -2,6 +2,9 @@
 
 namespace Sonar
 {
+	// Marks an ID whose object has been removed
+	static const unsigned int INVALID_OBJECT_INDEX = std::numeric_limits<unsigned int>::max( );
+
 	Minimap::Minimap( GameDataRef data ) : _data( data )
 	{
 		_background = std::make_shared<Rectangle>( _data );
@@ -12,6 +15,20 @@ namespace Sonar
 
 		_background->SetSize( DEFAULT_MINIMAP_BACKGROUND_WIDTH, DEFAULT_MINIMAP_BACKGROUND_HEIGHT );
 		_mapSize = glm::vec2( DEFAULT_MINIMAP_INTERNAL_MAP_WIDTH, DEFAULT_MINIMAP_INTERNAL_MAP_HEIGHT );
+
+		_markers.setPrimitiveType( sf::Triangles );
+
+		for ( unsigned int i = 0; i < DEFAULT_MINIMAP_OBJECT_POINT_COUNT; i++ )
+		{
+			const float angle = glm::radians( 360.0f * i / DEFAULT_MINIMAP_OBJECT_POINT_COUNT );
+
+			_markerPoints.push_back( sf::Vector2f( std::cos( angle ), std::sin( angle ) ) );
+		}
+
+		_isCachingEnabled = false;
+		_cacheInterval = 1.0f / DEFAULT_MINIMAP_CACHE_REFRESH_RATE;
+		_cacheTimer = 0;
+		_isCacheDirty = true;
 	}
 
 	Minimap::~Minimap( ) { }
@@ -20,37 +37,57 @@ namespace Sonar
 	{
 		_background->Draw( );
 
-		for ( const auto &object : _objects )
+		if ( !_isCachingEnabled )
 		{
-			if ( object.second._isShowing )
-			{
-				if ( std::find( _typesToHide.begin( ), _typesToHide.end( ), object.second._type ) == _typesToHide.end( ) )
-				{
-					glm::vec2 positionPercentage;
-					positionPercentage = object.second._position / _mapSize;
-
-					object.second._shape->SetPosition( _background->GetPosition( ) + ( _background->GetSize( ) * positionPercentage ) );
-
-					if ( object.second._shape->BoundingBoxCollision( *_background ) )
-					{
-						if ( IsPointWithinRange( object.second._shape->GetPositionX( ), _background->GetPositionX( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionX( OBJECT_POINTS::TOP_RIGHT ) )
-							&& IsPointWithinRange( object.second._shape->GetPositionY( ), _background->GetPositionY( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionY( OBJECT_POINTS::BOTTOM_LEFT ) )
-							&& IsPointWithinRange( object.second._shape->GetPositionX( OBJECT_POINTS::TOP_RIGHT ), _background->GetPositionX( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionX( OBJECT_POINTS::TOP_RIGHT ) )
-							&& IsPointWithinRange( object.second._shape->GetPositionY( OBJECT_POINTS::TOP_RIGHT ), _background->GetPositionY( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionY( OBJECT_POINTS::BOTTOM_LEFT ) )
-							&& IsPointWithinRange( object.second._shape->GetPositionX( OBJECT_POINTS::BOTTOM_RIGHT ), _background->GetPositionX( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionX( OBJECT_POINTS::TOP_RIGHT ) )
-							&& IsPointWithinRange( object.second._shape->GetPositionY( OBJECT_POINTS::BOTTOM_RIGHT ), _background->GetPositionY( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionY( OBJECT_POINTS::BOTTOM_LEFT ) )
-							&& IsPointWithinRange( object.second._shape->GetPositionX( OBJECT_POINTS::BOTTOM_LEFT ), _background->GetPositionX( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionX( OBJECT_POINTS::TOP_RIGHT ) )
-							&& IsPointWithinRange( object.second._shape->GetPositionY( OBJECT_POINTS::BOTTOM_LEFT ), _background->GetPositionY( OBJECT_POINTS::TOP_LEFT ), _background->GetPositionY( OBJECT_POINTS::BOTTOM_LEFT ) ) )
-						{ object.second._shape->Draw( ); }
-					}
-				}
-			}
+			BuildMarkers( );
+
+			if ( 0 < _markers.getVertexCount( ) )
+			{ _data->renderQueue.SubmitTriangles( &_markers[0], _markers.getVertexCount( ), nullptr, 0, 0.0f ); }
+
+			return;
 		}
+
+		const glm::uvec2 size( std::ceil( _background->GetWidth( ) ), std::ceil( _background->GetHeight( ) ) );
+
+		if ( 0 == size.x || 0 == size.y )
+		{ return; }
+
+		if ( size.x != _cache.getSize( ).x || size.y != _cache.getSize( ).y )
+		{
+			_cache.create( size.x, size.y );
+			_cacheSprite.setTexture( _cache.getTexture( ), true );
+
+			_isCacheDirty = true;
+		}
+
+		if ( _cacheSprite.getPosition( ) != sf::Vector2f( _background->GetPositionX( ), _background->GetPositionY( ) ) )
+		{
+			_cacheSprite.setPosition( _background->GetPositionX( ), _background->GetPositionY( ) );
+
+			_isCacheDirty = true;
+		}
+
+		if ( _isCacheDirty )
+		{ RedrawCache( ); }
+
+		// The cache holds colours already multiplied by their alpha
+		_data->renderQueue.Submit( _cacheSprite, sf::BlendMode( sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha ) );
 	}
 
 	void Minimap::Update( const float &dt )
 	{
 		_background->Update( dt );
+
+		if ( _isCachingEnabled )
+		{
+			_cacheTimer += dt;
+
+			if ( _cacheTimer >= _cacheInterval )
+			{
+				_cacheTimer = std::fmod( _cacheTimer, _cacheInterval );
+				_isCacheDirty = true;
+			}
+		}
 	}
 
 	glm::vec4 Minimap::GetLocalBounds( ) const
@@ -89,160 +126,279 @@ namespace Sonar
 	{
 		ObjectProperty objectProperty;
 
-		objectProperty._type = type;
+		objectProperty._id = _objectIndices.size( );
+		objectProperty._typeIndex = GetTypeIndex( type );
 		objectProperty._position = position;
+		objectProperty._radius = radius;
+		objectProperty._color = color.GetColor( );
+		objectProperty._isShowing = true;
 
-		objectProperty._shape = std::make_shared<Circle>( _data );
-		objectProperty._shape->SetRadius( radius );
-		objectProperty._shape->SetInsideColor( color );
-
-		_objects[_objects.size( )] = objectProperty;
+		_objectIndices.push_back( _objects.size( ) );
+		_objects.push_back( objectProperty );
 
-		return _objects.size( ) - 1;
+		return objectProperty._id;
 	}
 
 	void Minimap::RemoveObjectByID( const unsigned int &id )
 	{
 		if ( DoesObjectExist( id ) )
-		{ _objects.erase( id );}
+		{ RemoveObjectAtIndex( _objectIndices[id] ); }
 	}
 
 	void Minimap::RemoveObjectByType( const std::string &type )
 	{
-		for ( auto it = _objects.begin( ); it != _objects.end( ); ) 
+		unsigned int typeIndex;
+
+		if ( !FindTypeIndex( type, typeIndex ) )
+		{ return; }
+
+		unsigned int i = 0;
+
+		while ( i < _objects.size( ) )
 		{
-			if ( it->second._type == type )
-			{ it = _objects.erase( it ); }
+			if ( typeIndex == _objects[i]._typeIndex )
+			{ RemoveObjectAtIndex( i ); }
 			else
-			{ ++it; }
+			{ i++; }
 		}
 	}
 
 	void Minimap::HideObjectByType( const std::string &type )
 	{
-		if ( std::find( _typesToHide.begin( ), _typesToHide.end( ), type ) == _typesToHide.end( ) )
-		{ _typesToHide.push_back( type ); }
+		const unsigned int typeIndex = GetTypeIndex( type );
+
+		_hiddenTypes[typeIndex >> 6] |= std::uint64_t( 1 ) << ( typeIndex & 63 );
 	}
 
 	void Minimap::ShowObjectByType( const std::string &type )
-	{ _typesToHide.erase( std::remove( _typesToHide.begin( ), _typesToHide.end( ), type ), _typesToHide.end( ) ); }
+	{
+		unsigned int typeIndex;
+
+		if ( FindTypeIndex( type, typeIndex ) )
+		{ _hiddenTypes[typeIndex >> 6] &= ~( std::uint64_t( 1 ) << ( typeIndex & 63 ) ); }
+	}
 
 	void Minimap::HideObjectByID( const unsigned int &id )
 	{
 		if ( DoesObjectExist( id ) )
-		{ _objects.at( id )._isShowing = false; }
+		{ _objects[_objectIndices[id]]._isShowing = false; }
 	}
 
 	void Minimap::ShowObjectByID( const unsigned int &id )
 	{
 		if ( DoesObjectExist( id ) )
-		{ _objects.at( id )._isShowing = true; }
+		{ _objects[_objectIndices[id]]._isShowing = true; }
 	}
 
 	void Minimap::UpdateObjectByID( const unsigned int &id, const std::string &type, const glm::vec2 &position, const float &radius, const Color &color )
 	{
 		if ( DoesObjectExist( id ) )
 		{
-			_objects.at( id )._type = type;
-			_objects.at( id )._position = position;
+			ObjectProperty &object = _objects[_objectIndices[id]];
 
-			_objects.at( id )._shape->SetRadius( radius );
-			_objects.at( id )._shape->SetInsideColor( color );
+			object._typeIndex = GetTypeIndex( type );
+			object._position = position;
+			object._radius = radius;
+			object._color = color.GetColor( );
 		}
 	}
 
 	void Minimap::UpdateObjectTypeByID( const unsigned int &id, const std::string &type )
 	{
 		if ( DoesObjectExist( id ) )
-		{ _objects.at( id )._type = type; }
+		{ _objects[_objectIndices[id]]._typeIndex = GetTypeIndex( type ); }
 	}
 
 	void Minimap::UpdateObjectPositionByID( const unsigned int &id, const glm::vec2 &position )
 	{
 		if ( DoesObjectExist( id ) )
-		{ _objects.at( id )._position = position; }
+		{ _objects[_objectIndices[id]]._position = position; }
 	}
 
 	void Minimap::UpdateObjectRadiusByID( const unsigned int &id, const float &radius )
 	{
 		if ( DoesObjectExist( id ) )
-		{ _objects.at( id )._shape->SetRadius( radius ); }
+		{ _objects[_objectIndices[id]]._radius = radius; }
 	}
 
 	void Minimap::UpdateObjectColorByID( const unsigned int &id, const Color &color )
 	{
 		if ( DoesObjectExist( id ) )
-		{ _objects.at( id )._shape->SetInsideColor( color ); }
+		{ _objects[_objectIndices[id]]._color = color.GetColor( ); }
 	}
 
 	void Minimap::UpdateObjectByType( const std::string &oldType, const std::string &type, const glm::vec2 &position, const float &radius, const Color &color )
 	{
+		unsigned int oldTypeIndex;
+
+		if ( !FindTypeIndex( oldType, oldTypeIndex ) )
+		{ return; }
+
+		const unsigned int typeIndex = GetTypeIndex( type );
+
 		for ( auto &object : _objects )
 		{
-			if ( oldType == object.second._type )
+			if ( oldTypeIndex == object._typeIndex )
 			{
-				object.second._type = type;
-				object.second._position = position;
-
-				object.second._shape->SetRadius( radius );
-				object.second._shape->SetInsideColor( color );
+				object._typeIndex = typeIndex;
+				object._position = position;
+				object._radius = radius;
+				object._color = color.GetColor( );
 			}
 		}
 	}
 
 	void Minimap::UpdateObjectTypeByType( const std::string &oldType, const std::string &type )
 	{
+		unsigned int oldTypeIndex;
+
+		if ( !FindTypeIndex( oldType, oldTypeIndex ) )
+		{ return; }
+
+		const unsigned int typeIndex = GetTypeIndex( type );
+
 		for ( auto &object : _objects )
 		{
-			if ( oldType == object.second._type )
-			{ object.second._type = type; }
+			if ( oldTypeIndex == object._typeIndex )
+			{ object._typeIndex = typeIndex; }
 		}
 	}
 
 	void Minimap::UpdateObjectPositionByType( const std::string &type, const glm::vec2 &position )
 	{
+		unsigned int typeIndex;
+
+		if ( !FindTypeIndex( type, typeIndex ) )
+		{ return; }
+
 		for ( auto &object : _objects )
 		{
-			if ( type == object.second._type )
-			{ object.second._position = position; }
+			if ( typeIndex == object._typeIndex )
+			{ object._position = position; }
 		}
 	}
 
 	void Minimap::UpdateObjectRadiusByType( const std::string &type, const float &radius )
 	{
+		unsigned int typeIndex;
+
+		if ( !FindTypeIndex( type, typeIndex ) )
+		{ return; }
+
 		for ( auto &object : _objects )
 		{
-			if ( type == object.second._type )
-			{ object.second._shape->SetRadius( radius ); }
+			if ( typeIndex == object._typeIndex )
+			{ object._radius = radius; }
 		}
 	}
 
 	void Minimap::UpdateObjectColorByType( const std::string &type, const Color &color )
 	{
+		unsigned int typeIndex;
+
+		if ( !FindTypeIndex( type, typeIndex ) )
+		{ return; }
+
 		for ( auto &object : _objects )
 		{
-			if ( type == object.second._type )
-			{ object.second._shape->SetInsideColor( color ); }
+			if ( typeIndex == object._typeIndex )
+			{ object._color = color.GetColor( ); }
 		}
 	}
 
-	bool Minimap::IsPointWithinRange( const float &point, const float &start, const float &end ) const
+	bool Minimap::DoesObjectExist( const unsigned int &id ) const
+	{ return id < _objectIndices.size( ) && INVALID_OBJECT_INDEX != _objectIndices[id]; }
+
+	unsigned int Minimap::GetTypeIndex( const std::string &type )
 	{
-		if ( point >= start && point <= end )
-		{ return true; }
-		else
+		const auto found = _typeIndices.find( type );
+
+		if ( _typeIndices.end( ) != found )
+		{ return found->second; }
+
+		const unsigned int typeIndex = _typeIndices.size( );
+		_typeIndices[type] = typeIndex;
+
+		if ( ( typeIndex >> 6 ) >= _hiddenTypes.size( ) )
+		{ _hiddenTypes.push_back( 0 ); }
+
+		return typeIndex;
+	}
+
+	bool Minimap::FindTypeIndex( const std::string &type, unsigned int &index ) const
+	{
+		const auto found = _typeIndices.find( type );
+
+		if ( _typeIndices.end( ) == found )
 		{ return false; }
+
+		index = found->second;
+
+		return true;
 	}
 
-	bool Minimap::DoesObjectExist( const unsigned int &id )
+	bool Minimap::IsTypeHidden( const unsigned int &typeIndex ) const
+	{ return 0 != ( ( _hiddenTypes[typeIndex >> 6] >> ( typeIndex & 63 ) ) & 1 ); }
+
+	void Minimap::RemoveObjectAtIndex( const unsigned int &index )
 	{
-		if ( id < _objects.size( ) )
+		_objectIndices[_objects[index]._id] = INVALID_OBJECT_INDEX;
+
+		if ( index + 1 < _objects.size( ) )
 		{
-			if ( _objects.find( id ) != _objects.end( ) )
-			{ return true; }
+			_objects[index] = _objects.back( );
+			_objectIndices[_objects[index]._id] = index;
 		}
 
-		return false;
+		_objects.pop_back( );
+	}
+
+	void Minimap::BuildMarkers( )
+	{
+		_markers.clear( );
+
+		const glm::vec2 topLeft = _background->GetPosition( );
+		const glm::vec2 size = _background->GetSize( );
+		const glm::vec2 bottomRight = topLeft + size;
+		const glm::vec2 scale = size / _mapSize;
+
+		const unsigned int pointCount = _markerPoints.size( );
+
+		for ( const auto &object : _objects )
+		{
+			if ( !object._isShowing || IsTypeHidden( object._typeIndex ) )
+			{ continue; }
+
+			// The marker's top left corner sits on the object's position, only markers completely inside the minimap are drawn
+			const glm::vec2 corner = topLeft + ( object._position * scale );
+			const float diameter = object._radius * 2.0f;
+
+			if ( corner.x < topLeft.x || corner.y < topLeft.y || corner.x + diameter > bottomRight.x || corner.y + diameter > bottomRight.y )
+			{ continue; }
+
+			const sf::Vector2f centre( corner.x + object._radius, corner.y + object._radius );
+
+			for ( unsigned int i = 0; i < pointCount; i++ )
+			{
+				_markers.append( sf::Vertex( centre, object._color ) );
+				_markers.append( sf::Vertex( centre + ( _markerPoints[i] * object._radius ), object._color ) );
+				_markers.append( sf::Vertex( centre + ( _markerPoints[( i + 1 ) % pointCount] * object._radius ), object._color ) );
+			}
+		}
+	}
+
+	void Minimap::RedrawCache( )
+	{
+		BuildMarkers( );
+
+		const sf::Vector2u size = _cache.getSize( );
+
+		_cache.setView( sf::View( sf::FloatRect( _background->GetPositionX( ), _background->GetPositionY( ), static_cast<float>( size.x ), static_cast<float>( size.y ) ) ) );
+		_cache.clear( sf::Color::Transparent );
+		_cache.draw( _markers );
+		_cache.display( );
+
+		_isCacheDirty = false;
 	}
 
 	void Minimap::SetPosition( const glm::vec2 &position )
@@ -416,5 +572,18 @@ namespace Sonar
 
 	float Minimap::GetScale( ) const
 	{ return _background->GetScaleX( ); }
-}
 
+	void Minimap::EnableCaching( const float &refreshRate )
+	{
+		_isCachingEnabled = true;
+		_cacheInterval = 1.0f / std::max( refreshRate, 0.001f );
+		_cacheTimer = 0;
+		_isCacheDirty = true;
+	}
+
+	void Minimap::DisableCaching( )
+	{ _isCachingEnabled = false; }
+
+	const bool &Minimap::IsCachingEnabled( ) const
+	{ return _isCachingEnabled; }
+}
@@ -20,7 +20,7 @@ namespace Sonar
 	{
 		for ( unsigned int i = 0; i < _layers.size( ); i++ )
 		{
-			if ( _layerStatus.at( i ).first )
+			if ( _layerStatus.at( i ).second )
 			{ _layers.at( i ).Draw( ); }
 		}
 	}
@@ -48,6 +48,14 @@ namespace Sonar
 		AddLayer( scrollingBackground );
 	}
 
+	void Parallax::AddRepeatedLayer( const std::string &filepath, const glm::vec2 &size )
+	{
+		ScrollingBackground scrollingBackground( _data );
+		scrollingBackground.SetRepeatedTexture( filepath, size );
+
+		AddLayer( scrollingBackground );
+	}
+
 	void Parallax::DeleteLayer( const unsigned int &index )
 	{
 		_layers.erase( _layers.begin( ) + index );
@@ -77,7 +85,7 @@ namespace Sonar
 
 	void Parallax::SetDirectionForAllLayers( const ScrollingBackground::DIRECTION &direction )
 	{
-		for ( auto layer : _layers )
+		for ( auto &layer : _layers )
 		{ layer.SetDirection( direction ); }
 	}
 
@@ -86,7 +94,7 @@ namespace Sonar
 
 	void Parallax::SetOrientationForAllLayers( const ScrollingBackground::ORIENTATION &orientation )
 	{
-		for ( auto layer : _layers )
+		for ( auto &layer : _layers )
 		{ layer.SetOrientation( orientation ); }
 	}
 
@@ -95,7 +103,7 @@ namespace Sonar
 
 	void Parallax::SetScrollToManualForAllLayers( const ScrollingBackground::ORIENTATION &orientation )
 	{
-		for ( auto layer : _layers )
+		for ( auto &layer : _layers )
 		{ layer.SetScrollToManual( orientation ); }
 	}
 
@@ -104,7 +112,7 @@ namespace Sonar
 
 	void Parallax::MoveAllLayers( const ScrollingBackground::DIRECTION &direction, const float &speed )
 	{
-		for ( auto layer : _layers )
+		for ( auto &layer : _layers )
 		{ layer.Move( direction, speed ); }
 	}
 
@@ -113,7 +121,7 @@ namespace Sonar
 
 	void Parallax::SetOffsetForAllLayers( const float &offsetX, const float &offsetY )
 	{
-		for ( auto layer : _layers )
+		for ( auto &layer : _layers )
 		{ layer.SetOffset( offsetX, offsetY ); }
 	}
 
@@ -122,7 +130,7 @@ namespace Sonar
 
 	void Parallax::SetSpeedForAllLayers( const float &speed )
 	{
-		for ( auto layer : _layers )
+		for ( auto &layer : _layers )
 		{ layer.SetSpeed( speed ); }
 	}
 
@@ -131,7 +139,7 @@ namespace Sonar
 
 	void Parallax::ResetAllLayers( )
 	{
-		for ( auto layer : _layers )
+		for ( auto &layer : _layers )
 		{ layer.Reset( ); }
 	}
 
@@ -0,0 +1,303 @@
+#include "pch.hpp"
+
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 )
+	#include <xmmintrin.h>
+	#define PARTICLE_EMITTER_SSE
+#endif
+
+namespace Sonar
+{
+	ParticleEmitter::ParticleEmitter( GameDataRef data, const unsigned int &capacity ) : _data( data )
+	{
+		_count = 0;
+		_capacity = 0;
+
+		SetCapacity( capacity );
+
+		_textureRect = glm::ivec4( 0, 0, 0, 0 );
+
+		_emissionRate = 0;
+		_emissionAccumulator = 0;
+
+		_position = glm::vec2( 0, 0 );
+		_direction = 0;
+		_spread = 360.0f;
+		_minimumSpeed = _maximumSpeed = DEFAULT_PARTICLE_SPEED;
+		_minimumLifetime = _maximumLifetime = DEFAULT_PARTICLE_LIFETIME;
+		_gravity = glm::vec2( 0, 0 );
+		_startSize = _endSize = DEFAULT_PARTICLE_SIZE;
+		_startColor = _endColor = Color::White;
+
+		// Any non zero seed works, offset by the address so emitters created together don't match
+		_randomState = 0x9E3779B9u ^ static_cast<std::uint32_t>( reinterpret_cast<std::uintptr_t>( this ) );
+
+		if ( 0 == _randomState )
+		{ _randomState = 1; }
+	}
+
+	ParticleEmitter::~ParticleEmitter( ) { }
+
+	void ParticleEmitter::Update( const float &dt )
+	{
+		Integrate( dt );
+		RemoveExpired( );
+
+		if ( _emissionRate > 0 )
+		{
+			_emissionAccumulator += _emissionRate * dt;
+
+			const unsigned int count = static_cast<unsigned int>( _emissionAccumulator );
+			_emissionAccumulator -= count;
+
+			Emit( count );
+		}
+	}
+
+	void ParticleEmitter::Draw( )
+	{
+		if ( 0 == _count )
+		{ return; }
+
+		BuildVertices( );
+
+		_data->renderQueue.SubmitTriangles( _vertices._vertices.data( ), _vertices._vertexCount, _vertices._texture, 0, 0.0f );
+	}
+
+	void ParticleEmitter::Emit( const unsigned int &count )
+	{
+		const unsigned int end = std::min( _capacity, _count + count );
+
+		for ( unsigned int i = _count; i < end; i++ )
+		{
+			const float angle = glm::radians( _direction + Random( -_spread * 0.5f, _spread * 0.5f ) );
+			const float speed = Random( _minimumSpeed, _maximumSpeed );
+
+			_positionX[i] = _position.x;
+			_positionY[i] = _position.y;
+			_velocityX[i] = std::cos( angle ) * speed;
+			_velocityY[i] = std::sin( angle ) * speed;
+			_age[i] = 0;
+			_inverseLifetime[i] = 1.0f / std::max( Random( _minimumLifetime, _maximumLifetime ), 0.0001f );
+		}
+
+		_count = end;
+	}
+
+	void ParticleEmitter::Clear( )
+	{ _count = 0; }
+
+	void ParticleEmitter::SetCapacity( const unsigned int &capacity )
+	{
+		_capacity = capacity;
+		_count = std::min( _count, _capacity );
+
+		// Rounded up to whole groups of four so the update never needs a separate tail for the last few particles
+		const unsigned int size = ( _capacity + 3 ) & ~3u;
+
+		_positionX.resize( size );
+		_positionY.resize( size );
+		_velocityX.resize( size );
+		_velocityY.resize( size );
+		_age.resize( size );
+		_inverseLifetime.resize( size );
+
+		_vertices._vertices.resize( _capacity * 6 );
+	}
+
+	unsigned int ParticleEmitter::GetCapacity( ) const
+	{ return _capacity; }
+
+	unsigned int ParticleEmitter::GetParticleCount( ) const
+	{ return _count; }
+
+	void ParticleEmitter::SetEmissionRate( const float &rate )
+	{ _emissionRate = std::max( 0.0f, rate ); }
+
+	const float &ParticleEmitter::GetEmissionRate( ) const
+	{ return _emissionRate; }
+
+	void ParticleEmitter::SetPosition( const glm::vec2 &position )
+	{ _position = position; }
+
+	void ParticleEmitter::SetPosition( const float &x, const float &y )
+	{ SetPosition( glm::vec2( x, y ) ); }
+
+	const glm::vec2 &ParticleEmitter::GetPosition( ) const
+	{ return _position; }
+
+	void ParticleEmitter::SetDirection( const float &direction, const float &spread )
+	{
+		_direction = direction;
+		_spread = spread;
+	}
+
+	void ParticleEmitter::SetSpeed( const float &minimum, const float &maximum )
+	{
+		_minimumSpeed = minimum;
+		_maximumSpeed = maximum;
+	}
+
+	void ParticleEmitter::SetLifetime( const float &minimum, const float &maximum )
+	{
+		_minimumLifetime = minimum;
+		_maximumLifetime = maximum;
+	}
+
+	void ParticleEmitter::SetGravity( const glm::vec2 &gravity )
+	{ _gravity = gravity; }
+
+	void ParticleEmitter::SetSize( const float &start, const float &end )
+	{
+		_startSize = start;
+		_endSize = end;
+	}
+
+	void ParticleEmitter::SetColor( const Color &start, const Color &end )
+	{
+		_startColor = start;
+		_endColor = end;
+	}
+
+	void ParticleEmitter::SetTexture( const std::string &filepath )
+	{
+		if ( _data->assets.IsInTextureAtlas( filepath ) )
+		{
+			SetTexture( _data->assets.GetTextureAtlasRegion( filepath ) );
+
+			return;
+		}
+
+		SetTexture( std::make_shared<Texture>( filepath ) );
+	}
+
+	void ParticleEmitter::SetTexture( std::shared_ptr<Texture> texture )
+	{
+		_texture = texture;
+
+		const sf::Vector2u size = _texture->GetTexture( )->getSize( );
+		_textureRect = glm::ivec4( 0, 0, size.x, size.y );
+	}
+
+	void ParticleEmitter::SetTexture( const TextureAtlas::Region &region )
+	{
+		_texture = region._page;
+		_textureRect = region._rect;
+	}
+
+	void ParticleEmitter::RemoveTexture( )
+	{
+		_texture.reset( );
+		_textureRect = glm::ivec4( 0, 0, 0, 0 );
+	}
+
+	void ParticleEmitter::Integrate( const float &dt )
+	{
+		// Groups of four past the live count are padding or dead particles, updating them is harmless and saves a scalar tail
+		const unsigned int count = ( _count + 3 ) & ~3u;
+
+		float *positionX = _positionX.data( ), *positionY = _positionY.data( );
+		float *velocityX = _velocityX.data( ), *velocityY = _velocityY.data( );
+		float *age = _age.data( );
+
+	#ifdef PARTICLE_EMITTER_SSE
+		const __m128 delta = _mm_set1_ps( dt );
+		const __m128 gravityX = _mm_set1_ps( _gravity.x * dt );
+		const __m128 gravityY = _mm_set1_ps( _gravity.y * dt );
+
+		for ( unsigned int i = 0; i < count; i += 4 )
+		{
+			const __m128 newVelocityX = _mm_add_ps( _mm_loadu_ps( velocityX + i ), gravityX );
+			const __m128 newVelocityY = _mm_add_ps( _mm_loadu_ps( velocityY + i ), gravityY );
+
+			_mm_storeu_ps( velocityX + i, newVelocityX );
+			_mm_storeu_ps( velocityY + i, newVelocityY );
+			_mm_storeu_ps( positionX + i, _mm_add_ps( _mm_loadu_ps( positionX + i ), _mm_mul_ps( newVelocityX, delta ) ) );
+			_mm_storeu_ps( positionY + i, _mm_add_ps( _mm_loadu_ps( positionY + i ), _mm_mul_ps( newVelocityY, delta ) ) );
+			_mm_storeu_ps( age + i, _mm_add_ps( _mm_loadu_ps( age + i ), delta ) );
+		}
+	#else
+		const float gravityX = _gravity.x * dt, gravityY = _gravity.y * dt;
+
+		for ( unsigned int i = 0; i < count; i++ )
+		{
+			velocityX[i] += gravityX;
+			velocityY[i] += gravityY;
+			positionX[i] += velocityX[i] * dt;
+			positionY[i] += velocityY[i] * dt;
+			age[i] += dt;
+		}
+	#endif
+	}
+
+	void ParticleEmitter::RemoveExpired( )
+	{
+		unsigned int i = 0;
+
+		while ( i < _count )
+		{
+			if ( _age[i] * _inverseLifetime[i] < 1.0f )
+			{
+				i++;
+
+				continue;
+			}
+
+			// Order doesn't matter, so the last particle fills the gap and the arrays stay packed
+			_count--;
+
+			_positionX[i] = _positionX[_count];
+			_positionY[i] = _positionY[_count];
+			_velocityX[i] = _velocityX[_count];
+			_velocityY[i] = _velocityY[_count];
+			_age[i] = _age[_count];
+			_inverseLifetime[i] = _inverseLifetime[_count];
+		}
+	}
+
+	void ParticleEmitter::BuildVertices( )
+	{
+		const sf::Color start = _startColor.GetColor( ), end = _endColor.GetColor( );
+
+		const float textureLeft = static_cast<float>( _textureRect.x ), textureTop = static_cast<float>( _textureRect.y );
+		const float textureRight = textureLeft + _textureRect.z, textureBottom = textureTop + _textureRect.w;
+
+		sf::Vertex *vertex = _vertices._vertices.data( );
+
+		for ( unsigned int i = 0; i < _count; i++ )
+		{
+			const float life = std::min( _age[i] * _inverseLifetime[i], 1.0f );
+			const float halfSize = ( _startSize + ( ( _endSize - _startSize ) * life ) ) * 0.5f;
+
+			const sf::Color color(
+				static_cast<sf::Uint8>( start.r + ( ( end.r - start.r ) * life ) ),
+				static_cast<sf::Uint8>( start.g + ( ( end.g - start.g ) * life ) ),
+				static_cast<sf::Uint8>( start.b + ( ( end.b - start.b ) * life ) ),
+				static_cast<sf::Uint8>( start.a + ( ( end.a - start.a ) * life ) ) );
+
+			const float left = _positionX[i] - halfSize, top = _positionY[i] - halfSize;
+			const float right = _positionX[i] + halfSize, bottom = _positionY[i] + halfSize;
+
+			vertex[0] = sf::Vertex( sf::Vector2f( left, top ), color, sf::Vector2f( textureLeft, textureTop ) );
+			vertex[1] = sf::Vertex( sf::Vector2f( right, top ), color, sf::Vector2f( textureRight, textureTop ) );
+			vertex[2] = sf::Vertex( sf::Vector2f( right, bottom ), color, sf::Vector2f( textureRight, textureBottom ) );
+			vertex[3] = vertex[0];
+			vertex[4] = vertex[2];
+			vertex[5] = sf::Vertex( sf::Vector2f( left, bottom ), color, sf::Vector2f( textureLeft, textureBottom ) );
+
+			vertex += 6;
+		}
+
+		_vertices._vertexCount = _count * 6;
+		_vertices._texture = nullptr != _texture ? _texture->GetTexture( ) : nullptr;
+	}
+
+	float ParticleEmitter::Random( const float &minimum, const float &maximum )
+	{
+		// xorshift32, far cheaper than the standard generators when emitting thousands of particles a frame
+		_randomState ^= _randomState << 13;
+		_randomState ^= _randomState >> 17;
+		_randomState ^= _randomState << 5;
+
+		return minimum + ( ( maximum - minimum ) * ( ( _randomState >> 8 ) * ( 1.0f / 16777216.0f ) ) );
+	}
+}
@@ -216,6 +216,8 @@ namespace Sonar
 		}
 
 		CalculateProgressBarSize( );
+
+		ReportVisualChange( );
 	}
 
 	const float &ProgressBar::GetValue( ) const
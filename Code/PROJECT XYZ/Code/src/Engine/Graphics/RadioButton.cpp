@@ -28,6 +28,7 @@ namespace Sonar
 		_isSelected = DEFAULT_RADIO_BUTTON_IS_CLICKED_STATUS;
 
 		_isMouseDown = false;
+		_wasMouseOver = false;
 
 		_timeSelected = 0;
 	}
@@ -47,6 +48,9 @@ namespace Sonar
 		_outerLayer->Update( dt );
 		_insideLayer->Update( dt );
 
+		const bool wasSelected = _isSelected;
+		const bool isMouseOver = _outerLayer->IsMouseOver( );
+
 		if ( _outerLayer->IsClicked( _buttonToClick ) )
 		{
 			if ( !_isMouseDown )
@@ -73,6 +77,11 @@ namespace Sonar
 
 			_isMouseDown = false;
 		}
+
+		if ( wasSelected != _isSelected || isMouseOver != _wasMouseOver )
+		{ ReportVisualChange( ); }
+
+		_wasMouseOver = isMouseOver;
 	}
 
 	void RadioButton::PollInput( const float &dt, const Event &event ) { }
@@ -228,16 +237,28 @@ namespace Sonar
 
 	void RadioButton::EnableSelection( )
 	{
+		if ( !_isSelected )
+		{ ReportVisualChange( ); }
+
 		_isSelected = true;
 
 		_timeSelected = Time::GetCurrentEpochDateTime( );
 	};
 
 	void RadioButton::DisableSelection( )
-	{ _isSelected = false; }
+	{
+		if ( _isSelected )
+		{ ReportVisualChange( ); }
+
+		_isSelected = false;
+	}
 
 	void RadioButton::ToggleSelection( )
-	{ _isSelected = !_isSelected; }
+	{
+		_isSelected = !_isSelected;
+
+		ReportVisualChange( );
+	}
 
 	const long long RadioButton::GetSelectedTime( ) const
 	{ return _timeSelected; }
@@ -69,25 +69,39 @@ namespace Sonar
 			newMenuComponentsVector.pop_back( );
 
 			_radioButtons = newMenuComponentsVector;
+
+			ReportVisualChange( );
 		}
 	}
 
 	void RadioButtonGroup::RemoveRadioButton( const unsigned int &index )
 	{
 		if ( index < _radioButtons.size( ) )
-		{ _radioButtons.erase( _radioButtons.begin( ) + index ); }
+		{
+			_radioButtons.erase( _radioButtons.begin( ) + index );
+
+			ReportVisualChange( );
+		}
 	}
 
 	void RadioButtonGroup::RemoveFirstRadioButton( )
 	{
 		if ( 0 < _radioButtons.size( ) )
-		{ _radioButtons.erase( _radioButtons.begin( ) ); }
+		{
+			_radioButtons.erase( _radioButtons.begin( ) );
+
+			ReportVisualChange( );
+		}
 	}
 
 	void RadioButtonGroup::RemoveLastRadioButton( )
 	{
 		if ( _radioButtons.size( ) > 0 )
-		{ _radioButtons.erase( _radioButtons.end( ) - 1 ); }
+		{
+			_radioButtons.erase( _radioButtons.end( ) - 1 );
+
+			ReportVisualChange( );
+		}
 	}
 
 	unsigned int RadioButtonGroup::GetSize( ) const
@@ -101,5 +115,27 @@ namespace Sonar
 		{ button->SetTheme( _theme ); }
 	}
 
+	bool RadioButtonGroup::HasVisualChanged( ) const
+	{
+		if ( MenuComponent::HasVisualChanged( ) )
+		{ return true; }
+
+		for ( const auto &button : _radioButtons )
+		{
+			if ( button->HasVisualChanged( ) )
+			{ return true; }
+		}
+
+		return false;
+	}
+
+	void RadioButtonGroup::ClearVisualChange( )
+	{
+		MenuComponent::ClearVisualChange( );
+
+		for ( const auto &button : _radioButtons )
+		{ button->ClearVisualChange( ); }
+	}
+
 }
 
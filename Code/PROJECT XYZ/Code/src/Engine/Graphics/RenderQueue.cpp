@@ -0,0 +1,733 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	RenderQueue::RenderQueue( )
+	{
+		_target = nullptr;
+		_isBatchingEnabled = DEFAULT_IS_RENDER_BATCHING_ENABLED;
+		_isSortingEnabled = DEFAULT_IS_RENDER_SORTING_ENABLED;
+		_isStateSortingEnabled = DEFAULT_IS_RENDER_STATE_SORTING_ENABLED;
+
+		_isSnapshotEnabled = _hasSkippedDrawable = _isSnapshotNew = false;
+		_snapshotTarget = nullptr;
+
+		_frameSubmissions = _frameCulled = 0;
+		_lastBatches = _lastVertices = _lastSubmissions = _lastCulled = 0;
+	}
+
+	RenderQueue::~RenderQueue( ) { }
+
+	void RenderQueue::SetTarget( sf::RenderTarget *target )
+	{
+		Flush( );
+
+		_target = target;
+	}
+
+	void RenderQueue::SetView( const sf::View &view )
+	{
+		// Anything queued so far belongs to the previous view
+		Flush( );
+
+		// The snapshot target's own view is left to the drawing thread, each pass carries the view it was recorded with
+		if ( IsRecording( ) )
+		{ _snapshotView = view; }
+		else if ( nullptr != _target )
+		{ _target->setView( view ); }
+	}
+
+	void RenderQueue::SetDefaultView( )
+	{
+		if ( nullptr != _target )
+		{ SetView( _target->getDefaultView( ) ); }
+	}
+
+	const sf::View &RenderQueue::GetView( ) const
+	{
+		if ( IsRecording( ) || nullptr == _target )
+		{ return _snapshotView; }
+
+		return _target->getView( );
+	}
+
+	glm::vec4 RenderQueue::GetViewBounds( ) const
+	{
+		if ( nullptr == _target )
+		{ return glm::vec4( 0, 0, 0, 0 ); }
+
+		const sf::View &view = GetView( );
+		glm::vec2 halfSize( view.getSize( ).x * 0.5f, view.getSize( ).y * 0.5f );
+
+		if ( 0.0f != view.getRotation( ) )
+		{
+			const float radians = view.getRotation( ) * ( 3.14159265f / 180.0f );
+			const float cosine = std::abs( std::cos( radians ) );
+			const float sine = std::abs( std::sin( radians ) );
+
+			halfSize = glm::vec2( ( halfSize.x * cosine ) + ( halfSize.y * sine ), ( halfSize.x * sine ) + ( halfSize.y * cosine ) );
+		}
+
+		return glm::vec4( view.getCenter( ).x - halfSize.x, view.getCenter( ).y - halfSize.y, halfSize.x * 2.0f, halfSize.y * 2.0f );
+	}
+
+	bool RenderQueue::IsVisible( const glm::vec4 &bounds )
+	{
+		if ( nullptr == _target )
+		{ return true; }
+
+		const glm::vec4 view = GetViewBounds( );
+
+		if ( bounds.x + bounds.z < view.x // Beyond the left of the view
+			|| bounds.x > view.x + view.z // Beyond the right of the view
+			|| bounds.y + bounds.w < view.y // Above the view
+			|| bounds.y > view.y + view.w // Below the view
+			)
+		{
+			_frameCulled++;
+
+			return false;
+		}
+
+		return true;
+	}
+
+	void RenderQueue::AddCulled( const unsigned int &count )
+	{ _frameCulled += count; }
+
+	void RenderQueue::Submit( const sf::Drawable &drawable, const sf::BlendMode &blendMode )
+	{ Submit( drawable, 0, 0.0f, blendMode ); }
+
+	void RenderQueue::Submit( const sf::Drawable &drawable, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode )
+	{
+		_frameSubmissions++;
+
+		if ( const sf::Sprite *sprite = dynamic_cast<const sf::Sprite *>( &drawable ) )
+		{ AddSprite( *sprite, layer, depth, blendMode ); }
+		else if ( const sf::Shape *shape = dynamic_cast<const sf::Shape *>( &drawable ) )
+		{ AddShape( *shape, layer, depth, blendMode ); }
+		else if ( const sf::Text *text = dynamic_cast<const sf::Text *>( &drawable ) )
+		{
+			Stage( MakeKey( layer, depth, nullptr, blendMode ), nullptr, blendMode );
+
+			_submissions.back( )._text = _stagedTexts.size( );
+			_stagedTexts.push_back( *text );
+		}
+		else if ( IsRecording( ) )
+		{
+			// A snapshot is drawn while the next frame is built, by then the drawable may have changed or be gone
+			if ( !_hasSkippedDrawable )
+			{ spdlog::warn( "Custom drawables can't be recorded into a snapshot and are skipped, submit their vertices with SubmitTriangles" ); }
+
+			_hasSkippedDrawable = true;
+		}
+		else
+		{
+			// Custom drawables can't be copied, so they are kept by address and drawn on their own in sorted order
+			Stage( MakeKey( layer, depth, nullptr, blendMode ), nullptr, blendMode );
+
+			_submissions.back( )._drawable = &drawable;
+		}
+	}
+
+	void RenderQueue::SubmitTriangles( const sf::Vertex *vertices, const std::size_t &vertexCount, const sf::Texture *texture, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode, const sf::Transform &transform )
+	{
+		_frameSubmissions++;
+
+		if ( 0 == vertexCount )
+		{ return; }
+
+		Stage( MakeKey( layer, depth, texture, blendMode ), texture, blendMode );
+
+		const std::size_t first = _stagedVertices.size( );
+
+		_stagedVertices.insert( _stagedVertices.end( ), vertices, vertices + vertexCount );
+		_submissions.back( )._vertexCount += static_cast<unsigned int>( vertexCount );
+
+		if ( sf::Transform::Identity != transform )
+		{
+			for ( std::size_t i = first; i < _stagedVertices.size( ); i++ )
+			{ _stagedVertices[i].position = transform.transformPoint( _stagedVertices[i].position ); }
+		}
+	}
+
+	void RenderQueue::Flush( )
+	{
+		if ( _isSortingEnabled )
+		{ SortSubmissions( ); }
+
+		if ( IsRecording( ) )
+		{ Record( ); }
+		else
+		{ DrawSubmissions( _target, _submissions.data( ), _submissions.size( ), _stagedVertices, _stagedTexts, _batches ); }
+
+		_submissions.clear( );
+		_stagedVertices.clear( );
+		_stagedTexts.clear( );
+	}
+
+	void RenderQueue::EndFrame( )
+	{
+		if ( _isSnapshotEnabled )
+		{
+			std::lock_guard<std::mutex> lock( _snapshotDrawMutex );
+
+			// Submissions and culling were counted by the thread that built the snapshot, along with anything it drew to other targets
+			_lastBatches = _drawing._batchCount + _snapshotBatches._drawCalls;
+			_lastVertices = _drawing._vertexCount + _snapshotBatches._vertexCount;
+			_lastSubmissions = _drawing._submissionCount;
+			_lastCulled = _drawing._culledCount;
+
+			_snapshotBatches._drawCalls = _snapshotBatches._vertexCount = 0;
+
+			return;
+		}
+
+		_lastBatches = _batches._drawCalls;
+		_lastVertices = _batches._vertexCount;
+		_lastSubmissions = _frameSubmissions;
+		_lastCulled = _frameCulled;
+
+		_batches._drawCalls = _batches._vertexCount = _frameSubmissions = _frameCulled = 0;
+	}
+
+	void RenderQueue::EnableSnapshots( )
+	{
+		Flush( );
+
+		_snapshotTarget = _target;
+		_snapshotView = nullptr != _target ? _target->getView( ) : sf::View( );
+		_isSnapshotEnabled = true;
+	}
+
+	void RenderQueue::PublishSnapshot( )
+	{
+		Flush( );
+
+		_recording._batchCount = _batches._drawCalls;
+		_recording._vertexCount = _batches._vertexCount;
+		_recording._submissionCount = _frameSubmissions;
+		_recording._culledCount = _frameCulled;
+
+		_batches._drawCalls = _batches._vertexCount = _frameSubmissions = _frameCulled = 0;
+
+		{
+			std::lock_guard<std::mutex> lock( _snapshotMutex );
+
+			std::swap( _recording, _published );
+			_isSnapshotNew = true;
+		}
+
+		// Either a snapshot the drawing thread never took or one it has finished with
+		_recording.Clear( );
+	}
+
+	void RenderQueue::DrawSnapshot( )
+	{
+		std::lock_guard<std::mutex> drawLock( _snapshotDrawMutex );
+
+		{
+			std::lock_guard<std::mutex> lock( _snapshotMutex );
+
+			if ( _isSnapshotNew )
+			{
+				std::swap( _drawing, _published );
+				_isSnapshotNew = false;
+			}
+		}
+
+		if ( nullptr == _snapshotTarget )
+		{ return; }
+
+		const sf::View view = _snapshotTarget->getView( );
+
+		for ( const auto &pass : _drawing._passes )
+		{
+			_snapshotTarget->setView( pass._view );
+
+			DrawSubmissions( _snapshotTarget, _drawing._submissions.data( ) + pass._firstSubmission, pass._submissionCount, _drawing._vertices, _drawing._texts, _snapshotBatches );
+		}
+
+		_snapshotTarget->setView( view );
+	}
+
+	void RenderQueue::DiscardSnapshots( )
+	{
+		std::lock_guard<std::mutex> drawLock( _snapshotDrawMutex );
+		std::lock_guard<std::mutex> lock( _snapshotMutex );
+
+		_published.Clear( );
+		_drawing.Clear( );
+		_isSnapshotNew = false;
+	}
+
+	void RenderQueue::EnableBatching( )
+	{ _isBatchingEnabled = true; }
+
+	void RenderQueue::DisableBatching( )
+	{ _isBatchingEnabled = false; }
+
+	void RenderQueue::ToggleBatching( )
+	{ _isBatchingEnabled = !_isBatchingEnabled; }
+
+	bool RenderQueue::IsBatchingEnabled( ) const
+	{ return _isBatchingEnabled; }
+
+	void RenderQueue::EnableSorting( )
+	{ _isSortingEnabled = true; }
+
+	void RenderQueue::DisableSorting( )
+	{ _isSortingEnabled = false; }
+
+	void RenderQueue::ToggleSorting( )
+	{ _isSortingEnabled = !_isSortingEnabled; }
+
+	bool RenderQueue::IsSortingEnabled( ) const
+	{ return _isSortingEnabled; }
+
+	void RenderQueue::EnableStateSorting( )
+	{ _isStateSortingEnabled = true; }
+
+	void RenderQueue::DisableStateSorting( )
+	{ _isStateSortingEnabled = false; }
+
+	bool RenderQueue::IsStateSortingEnabled( ) const
+	{ return _isStateSortingEnabled; }
+
+	unsigned int RenderQueue::GetBatchCount( ) const
+	{ return _lastBatches; }
+
+	unsigned int RenderQueue::GetVertexCount( ) const
+	{ return _lastVertices; }
+
+	unsigned int RenderQueue::GetSubmissionCount( ) const
+	{ return _lastSubmissions; }
+
+	unsigned int RenderQueue::GetCulledCount( ) const
+	{ return _lastCulled; }
+
+	std::uint64_t RenderQueue::MakeKey( const unsigned char &layer, const float &depth, const sf::Texture *texture, const sf::BlendMode &blendMode ) const
+	{
+		// Flip the sign bit of positive floats and every bit of negative ones so the bits sort in the same order as the values
+		std::uint32_t depthBits;
+		std::memcpy( &depthBits, &depth, sizeof( depthBits ) );
+		depthBits = ( depthBits & 0x80000000u ) ? ~depthBits : ( depthBits | 0x80000000u );
+
+		// Layer in the top 8 bits, depth in the next 32
+		std::uint64_t key = ( static_cast<std::uint64_t>( layer ) << 56 ) | ( static_cast<std::uint64_t>( depthBits ) << 24 );
+
+		if ( _isStateSortingEnabled )
+		{
+			// Texture in the next 16 bits and blend mode in the last 8, only used to group equal states so collisions just cost a batch
+			const std::uint64_t textureBits = nullptr == texture ? 0 : ( texture->getNativeHandle( ) & 0xFFFF );
+
+			std::uint64_t blendBits = 4;
+
+			if ( sf::BlendAlpha == blendMode )
+			{ blendBits = 0; }
+			else if ( sf::BlendAdd == blendMode )
+			{ blendBits = 1; }
+			else if ( sf::BlendMultiply == blendMode )
+			{ blendBits = 2; }
+			else if ( sf::BlendNone == blendMode )
+			{ blendBits = 3; }
+
+			key |= ( textureBits << 8 ) | blendBits;
+		}
+
+		return key;
+	}
+
+	void RenderQueue::Snapshot::Clear( )
+	{
+		_passes.clear( );
+		_submissions.clear( );
+		_vertices.clear( );
+		_texts.clear( );
+
+		_batchCount = _vertexCount = _submissionCount = _culledCount = 0;
+	}
+
+	bool RenderQueue::IsRecording( ) const
+	{ return _isSnapshotEnabled && nullptr != _target && _target == _snapshotTarget; }
+
+	void RenderQueue::Record( )
+	{
+		if ( _submissions.empty( ) )
+		{ return; }
+
+		Pass pass;
+		pass._view = _snapshotView;
+		pass._firstSubmission = _recording._submissions.size( );
+		pass._submissionCount = _submissions.size( );
+
+		const unsigned int firstVertex = static_cast<unsigned int>( _recording._vertices.size( ) );
+		const int firstText = static_cast<int>( _recording._texts.size( ) );
+
+		for ( auto submission : _submissions )
+		{
+			submission._firstVertex += firstVertex;
+
+			if ( submission._text >= 0 )
+			{ submission._text += firstText; }
+
+			_recording._submissions.push_back( submission );
+		}
+
+		_recording._vertices.insert( _recording._vertices.end( ), _stagedVertices.begin( ), _stagedVertices.end( ) );
+
+		for ( const auto &text : _stagedTexts )
+		{
+			_recording._texts.push_back( text );
+
+			// Builds the glyph geometry now, so the drawing thread doesn't touch the font while this thread may be using it
+			_recording._texts.back( ).getLocalBounds( );
+		}
+
+		_recording._passes.push_back( pass );
+	}
+
+	void RenderQueue::DrawSubmissions( sf::RenderTarget *target, const Submission *submissions, const std::size_t &count, const std::vector<sf::Vertex> &vertices, const std::vector<sf::Text> &texts, BatchList &batches )
+	{
+		for ( std::size_t i = 0; i < count; i++ )
+		{
+			const Submission &submission = submissions[i];
+
+			if ( submission._text >= 0 || nullptr != submission._drawable )
+			{
+				// Text and custom drawables can't join a batch, draw what has been batched so far to keep the order
+				DrawBatches( target, batches );
+
+				if ( nullptr != target )
+				{
+					if ( submission._text >= 0 )
+					{ target->draw( texts.at( submission._text ), sf::RenderStates( submission._blendMode ) ); }
+					else
+					{ target->draw( *submission._drawable, sf::RenderStates( submission._blendMode ) ); }
+
+					batches._drawCalls++;
+				}
+
+				continue;
+			}
+
+			if ( 0 == submission._vertexCount )
+			{ continue; }
+
+			Batch &batch = GetBatch( batches, submission._texture, submission._blendMode );
+
+			for ( unsigned int j = submission._firstVertex; j < submission._firstVertex + submission._vertexCount; j++ )
+			{ batch._vertices.append( vertices[j] ); }
+		}
+
+		DrawBatches( target, batches );
+	}
+
+	void RenderQueue::Stage( const std::uint64_t &key, const sf::Texture *texture, const sf::BlendMode &blendMode )
+	{
+		Submission submission;
+		submission._key = key;
+		submission._texture = texture;
+		submission._blendMode = blendMode;
+		submission._firstVertex = _stagedVertices.size( );
+		submission._vertexCount = 0;
+		submission._text = -1;
+		submission._drawable = nullptr;
+
+		_submissions.push_back( submission );
+	}
+
+	void RenderQueue::SortSubmissions( )
+	{
+		const std::size_t count = _submissions.size( );
+
+		if ( count < 2 )
+		{ return; }
+
+		_sortBuffer.resize( count );
+
+		for ( unsigned int shift = 0; shift < 64; shift += 8 )
+		{
+			std::array<unsigned int, 256> offsets{ };
+
+			for ( const auto &submission : _submissions )
+			{ offsets[( submission._key >> shift ) & 0xFF]++; }
+
+			// Every key has the same byte here, the pass wouldn't move anything
+			if ( count == offsets[( _submissions.front( )._key >> shift ) & 0xFF] )
+			{ continue; }
+
+			unsigned int total = 0;
+
+			for ( auto &offset : offsets )
+			{
+				const unsigned int bucket = offset;
+				offset = total;
+				total += bucket;
+			}
+
+			for ( const auto &submission : _submissions )
+			{ _sortBuffer[offsets[( submission._key >> shift ) & 0xFF]++] = submission; }
+
+			_submissions.swap( _sortBuffer );
+		}
+	}
+
+	void RenderQueue::DrawBatches( sf::RenderTarget *target, BatchList &batches )
+	{
+		if ( nullptr != target )
+		{
+			for ( unsigned int i = 0; i < batches._used; i++ )
+			{
+				const Batch &batch = batches._batches.at( i );
+
+				if ( 0 == batch._vertices.getVertexCount( ) )
+				{ continue; }
+
+				sf::RenderStates states( batch._blendMode );
+				states.texture = batch._texture;
+
+				target->draw( batch._vertices, states );
+
+				batches._drawCalls++;
+				batches._vertexCount += batch._vertices.getVertexCount( );
+			}
+		}
+
+		batches._used = 0;
+	}
+
+	RenderQueue::Batch &RenderQueue::GetBatch( BatchList &batches, const sf::Texture *texture, const sf::BlendMode &blendMode )
+	{
+		if ( _isBatchingEnabled && batches._used > 0 )
+		{
+			Batch &last = batches._batches.at( batches._used - 1 );
+
+			if ( last._texture == texture && last._blendMode == blendMode )
+			{ return last; }
+		}
+
+		if ( batches._used == batches._batches.size( ) )
+		{
+			batches._batches.push_back( Batch( ) );
+			batches._batches.back( )._vertices.setPrimitiveType( sf::Triangles );
+		}
+
+		Batch &batch = batches._batches.at( batches._used++ );
+
+		batch._texture = texture;
+		batch._blendMode = blendMode;
+		batch._vertices.clear( );
+
+		return batch;
+	}
+
+	void RenderQueue::AddSprite( const sf::Sprite &sprite, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode )
+	{
+		// Matches sf::Sprite, which draws nothing without a texture
+		if ( nullptr == sprite.getTexture( ) )
+		{ return; }
+
+		const sf::Transform &transform = sprite.getTransform( );
+		const sf::IntRect &rect = sprite.getTextureRect( );
+		const sf::Color color = sprite.getColor( );
+
+		const float width = static_cast<float>( std::abs( rect.width ) );
+		const float height = static_cast<float>( std::abs( rect.height ) );
+
+		const float left = static_cast<float>( rect.left );
+		const float right = left + rect.width;
+		const float top = static_cast<float>( rect.top );
+		const float bottom = top + rect.height;
+
+		sf::Vertex topLeft( transform.transformPoint( 0, 0 ), color, sf::Vector2f( left, top ) );
+		sf::Vertex bottomLeft( transform.transformPoint( 0, height ), color, sf::Vector2f( left, bottom ) );
+		sf::Vertex topRight( transform.transformPoint( width, 0 ), color, sf::Vector2f( right, top ) );
+		sf::Vertex bottomRight( transform.transformPoint( width, height ), color, sf::Vector2f( right, bottom ) );
+
+		Stage( MakeKey( layer, depth, sprite.getTexture( ), blendMode ), sprite.getTexture( ), blendMode );
+
+		AddTriangle( topLeft, bottomLeft, topRight );
+		AddTriangle( topRight, bottomLeft, bottomRight );
+	}
+
+	void RenderQueue::AddShape( const sf::Shape &shape, const unsigned char &layer, const float &depth, const sf::BlendMode &blendMode )
+	{
+		const sf::Transform &transform = shape.getTransform( );
+
+		// Each point is fetched once, circles come from a cached unit circle instead of a virtual call and a sin and cos per point
+		if ( const sf::CircleShape *circle = dynamic_cast<const sf::CircleShape *>( &shape ) )
+		{
+			const float radius = circle->getRadius( );
+			const std::vector<sf::Vector2f> &unitCircle = GetUnitCircle( GetCirclePointCount( radius, transform, circle->getPointCount( ) ) );
+
+			_shapePoints.resize( unitCircle.size( ) );
+
+			for ( std::size_t i = 0; i < unitCircle.size( ); i++ )
+			{ _shapePoints[i] = sf::Vector2f( radius + ( unitCircle[i].x * radius ), radius + ( unitCircle[i].y * radius ) ); }
+		}
+		else
+		{
+			_shapePoints.resize( shape.getPointCount( ) );
+
+			for ( std::size_t i = 0; i < _shapePoints.size( ); i++ )
+			{ _shapePoints[i] = shape.getPoint( i ); }
+		}
+
+		const std::size_t count = _shapePoints.size( );
+
+		if ( count < 3 )
+		{ return; }
+
+		// Bounds of the points without the outline, used to map the texture rectangle the same way sf::Shape does
+		sf::Vector2f minimum = _shapePoints[0], maximum = _shapePoints[0];
+
+		for ( std::size_t i = 1; i < count; i++ )
+		{
+			minimum.x = std::min( minimum.x, _shapePoints[i].x );
+			minimum.y = std::min( minimum.y, _shapePoints[i].y );
+			maximum.x = std::max( maximum.x, _shapePoints[i].x );
+			maximum.y = std::max( maximum.y, _shapePoints[i].y );
+		}
+
+		const sf::Vector2f size = maximum - minimum;
+		const sf::Vector2f center = minimum + ( size * 0.5f );
+		const sf::IntRect &rect = shape.getTextureRect( );
+
+		auto textureCoords = [&]( const sf::Vector2f &point )
+		{
+			const float xRatio = size.x > 0 ? ( point.x - minimum.x ) / size.x : 0;
+			const float yRatio = size.y > 0 ? ( point.y - minimum.y ) / size.y : 0;
+
+			return sf::Vector2f( rect.left + ( rect.width * xRatio ), rect.top + ( rect.height * yRatio ) );
+		};
+
+		const sf::Color fillColor = shape.getFillColor( );
+
+		if ( fillColor.a > 0 )
+		{
+			Stage( MakeKey( layer, depth, shape.getTexture( ), blendMode ), shape.getTexture( ), blendMode );
+
+			// Shapes are convex, so a fan from the first point covers them with two fewer triangles than points
+			const sf::Vertex first( transform.transformPoint( _shapePoints[0] ), fillColor, textureCoords( _shapePoints[0] ) );
+			sf::Vertex previous( transform.transformPoint( _shapePoints[1] ), fillColor, textureCoords( _shapePoints[1] ) );
+
+			for ( std::size_t i = 2; i < count; i++ )
+			{
+				const sf::Vertex current( transform.transformPoint( _shapePoints[i] ), fillColor, textureCoords( _shapePoints[i] ) );
+
+				AddTriangle( first, previous, current );
+
+				previous = current;
+			}
+		}
+
+		const float thickness = shape.getOutlineThickness( );
+		const sf::Color outlineColor = shape.getOutlineColor( );
+
+		if ( 0 != thickness && outlineColor.a > 0 )
+		{
+			auto normal = []( const sf::Vector2f &start, const sf::Vector2f &end )
+			{
+				sf::Vector2f result( start.y - end.y, end.x - start.x );
+				const float length = std::sqrt( ( result.x * result.x ) + ( result.y * result.y ) );
+
+				if ( 0 != length )
+				{ result /= length; }
+
+				return result;
+			};
+
+			auto dot = []( const sf::Vector2f &a, const sf::Vector2f &b )
+			{ return ( a.x * b.x ) + ( a.y * b.y ); };
+
+			// Inner and outer point of the outline for every corner, extruded the same way sf::Shape does
+			_outlineRing.resize( count * 2 );
+
+			for ( std::size_t i = 0; i < count; i++ )
+			{
+				const sf::Vector2f &previous = _shapePoints[( i + count - 1 ) % count];
+				const sf::Vector2f &current = _shapePoints[i];
+				const sf::Vector2f &next = _shapePoints[( i + 1 ) % count];
+
+				sf::Vector2f normal1 = normal( previous, current );
+				sf::Vector2f normal2 = normal( current, next );
+
+				if ( dot( normal1, center - current ) > 0 )
+				{ normal1 = -normal1; }
+
+				if ( dot( normal2, center - current ) > 0 )
+				{ normal2 = -normal2; }
+
+				const float factor = 1.0f + dot( normal1, normal2 );
+				const sf::Vector2f extrusion = ( normal1 + normal2 ) / factor;
+
+				_outlineRing[i * 2] = sf::Vertex( transform.transformPoint( current ), outlineColor );
+				_outlineRing[( i * 2 ) + 1] = sf::Vertex( transform.transformPoint( current + ( extrusion * thickness ) ), outlineColor );
+			}
+
+			// Keyed with the fill's texture so state sorting can't move the outline below its own fill
+			Stage( MakeKey( layer, depth, shape.getTexture( ), blendMode ), nullptr, blendMode );
+
+			for ( std::size_t i = 0; i < count; i++ )
+			{
+				const std::size_t next = ( i + 1 ) % count;
+
+				AddTriangle( _outlineRing[i * 2], _outlineRing[( i * 2 ) + 1], _outlineRing[next * 2] );
+				AddTriangle( _outlineRing[next * 2], _outlineRing[( i * 2 ) + 1], _outlineRing[( next * 2 ) + 1] );
+			}
+		}
+	}
+
+	const std::vector<sf::Vector2f> &RenderQueue::GetUnitCircle( const unsigned int &pointCount )
+	{
+		if ( pointCount >= _unitCircles.size( ) )
+		{ _unitCircles.resize( pointCount + 1 ); }
+
+		std::vector<sf::Vector2f> &unitCircle = _unitCircles[pointCount];
+
+		if ( unitCircle.empty( ) )
+		{
+			// Same points as sf::CircleShape, starting at the top
+			for ( unsigned int i = 0; i < pointCount; i++ )
+			{
+				const float angle = glm::radians( ( 360.0f * i / pointCount ) - 90.0f );
+
+				unitCircle.push_back( sf::Vector2f( std::cos( angle ), std::sin( angle ) ) );
+			}
+		}
+
+		return unitCircle;
+	}
+
+	unsigned int RenderQueue::GetCirclePointCount( const float &radius, const sf::Transform &transform, const unsigned int &maximum ) const
+	{
+		if ( nullptr == _target || maximum <= DEFAULT_RENDER_CIRCLE_MINIMUM_POINT_COUNT )
+		{ return maximum; }
+
+		const sf::View &view = GetView( );
+		const float *matrix = transform.getMatrix( );
+
+		// Radius in pixels, from the object's scale and how many pixels a world unit covers with the current view
+		const float scale = std::sqrt( std::abs( ( matrix[0] * matrix[5] ) - ( matrix[1] * matrix[4] ) ) );
+		const float pixelsPerUnit = ( _target->getSize( ).x * view.getViewport( ).width ) / view.getSize( ).x;
+		const float screenRadius = radius * scale * pixelsPerUnit;
+
+		if ( screenRadius <= DEFAULT_RENDER_CIRCLE_TOLERANCE )
+		{ return DEFAULT_RENDER_CIRCLE_MINIMUM_POINT_COUNT; }
+
+		// Fewest sides whose edges stay within the tolerance of the true circle
+		const float sides = glm::radians( 180.0f ) / std::acos( 1.0f - ( DEFAULT_RENDER_CIRCLE_TOLERANCE / screenRadius ) );
+
+		return std::min( maximum, std::max( static_cast<unsigned int>( DEFAULT_RENDER_CIRCLE_MINIMUM_POINT_COUNT ), static_cast<unsigned int>( std::ceil( sides ) ) ) );
+	}
+
+	void RenderQueue::AddTriangle( const sf::Vertex &a, const sf::Vertex &b, const sf::Vertex &c )
+	{
+		_stagedVertices.push_back( a );
+		_stagedVertices.push_back( b );
+		_stagedVertices.push_back( c );
+
+		_submissions.back( )._vertexCount += 3;
+	}
+}
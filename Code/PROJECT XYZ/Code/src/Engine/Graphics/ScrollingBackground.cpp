@@ -12,6 +12,9 @@ namespace Sonar
 		_isSingleScroll = false;
 
 		_offsetX = _offsetY = 0;
+
+		_repeatedSize = glm::vec2( 0, 0 );
+		_textureOffset = glm::vec2( 0, 0 );
 	}
 
 	ScrollingBackground::~ScrollingBackground( ) { }
@@ -31,7 +34,40 @@ namespace Sonar
 		SetBackgroundPositions( );
 	}
 
+	void ScrollingBackground::SetRepeatedTexture( const std::string &filepath, const glm::vec2 &size )
+	{ SetRepeatedTexture( std::make_shared<Texture>( filepath ), size ); }
+
+	void ScrollingBackground::SetRepeatedTexture( std::shared_ptr<Texture> texture, const glm::vec2 &size )
+	{
+		// Cached textures are shared by every user of the image, so the repeat flag is set on a copy of its own
+		_repeatedTexture = std::make_shared<Texture>( );
+		*_repeatedTexture->GetTexture( ) = *texture->GetTexture( );
+		_repeatedTexture->SetRepeated( true );
+
+		_repeatedSize = size;
+		_textureOffset = glm::vec2( 0, 0 );
+
+		UpdateRepeatedQuad( );
+	}
+
+	bool ScrollingBackground::IsRepeated( ) const
+	{ return nullptr != _repeatedTexture; }
+
 	void ScrollingBackground::Update( const float &dt )
+	{
+		if ( nullptr != _repeatedTexture )
+		{ ScrollRepeatedTexture( dt ); }
+		else
+		{ ScrollSprites( dt ); }
+
+		if ( _isSingleScroll )
+		{
+			_speed = 0;
+			_isSingleScroll = false;
+		}
+	}
+
+	void ScrollingBackground::ScrollSprites( const float &dt )
 	{
 		for ( unsigned int i = 0; i < _backgrounds.size( ); i++ )
 		{
@@ -116,16 +152,57 @@ namespace Sonar
 				}
 			}
 		}
+	}
 
-		if ( _isSingleScroll )
-		{
-			_speed = 0;
-			_isSingleScroll = false;
-		}
+	void ScrollingBackground::ScrollRepeatedTexture( const float &dt )
+	{
+		if ( ScrollingBackground::DIRECTION::LEFT == _direction )
+		{ _textureOffset.x += _speed * dt; }
+		else if ( ScrollingBackground::DIRECTION::RIGHT == _direction )
+		{ _textureOffset.x -= _speed * dt; }
+		else if ( ScrollingBackground::DIRECTION::UP == _direction )
+		{ _textureOffset.y += _speed * dt; }
+		else if ( ScrollingBackground::DIRECTION::DOWN == _direction )
+		{ _textureOffset.y -= _speed * dt; }
+
+		// The texture repeats, so wrapping the offset changes nothing on screen but stops it losing precision over time
+		const glm::vec2 textureSize = _repeatedTexture->GetSize( );
+
+		if ( textureSize.x > 0 && textureSize.y > 0 )
+		{ _textureOffset = glm::mod( _textureOffset, textureSize ); }
+
+		UpdateRepeatedQuad( );
+	}
+
+	void ScrollingBackground::UpdateRepeatedQuad( )
+	{
+		glm::vec2 size = _repeatedSize;
+
+		if ( 0 >= size.x || 0 >= size.y )
+		{ size = _data->window.GetSize( ); }
+
+		const float left = _offsetX, top = _offsetY;
+		const float right = left + size.x, bottom = top + size.y;
+
+		_repeatedQuad._vertices[0] = sf::Vertex( sf::Vector2f( left, top ), sf::Vector2f( _textureOffset.x, _textureOffset.y ) );
+		_repeatedQuad._vertices[1] = sf::Vertex( sf::Vector2f( right, top ), sf::Vector2f( _textureOffset.x + size.x, _textureOffset.y ) );
+		_repeatedQuad._vertices[2] = sf::Vertex( sf::Vector2f( left, bottom ), sf::Vector2f( _textureOffset.x, _textureOffset.y + size.y ) );
+		_repeatedQuad._vertices[3] = _repeatedQuad._vertices[1];
+		_repeatedQuad._vertices[4] = sf::Vertex( sf::Vector2f( right, bottom ), sf::Vector2f( _textureOffset.x + size.x, _textureOffset.y + size.y ) );
+		_repeatedQuad._vertices[5] = _repeatedQuad._vertices[2];
+
+		_repeatedQuad._texture = _repeatedTexture->GetTexture( );
 	}
 
 	void ScrollingBackground::Draw( )
 	{
+		if ( nullptr != _repeatedTexture )
+		{
+			_data->renderQueue.SubmitTriangles( _repeatedQuad._vertices, 6, _repeatedQuad._texture, 0, 0.0f );
+
+			return;
+		}
+
 		for ( auto &background : _backgrounds )
 		{ background->Draw( ); }
 	}
@@ -186,6 +263,12 @@ namespace Sonar
 	{
 		_direction = _originalDirection;
 		SetBackgroundPositions( );
+
+		if ( nullptr != _repeatedTexture )
+		{
+			_textureOffset = glm::vec2( 0, 0 );
+			UpdateRepeatedQuad( );
+		}
 	}
 
 	void ScrollingBackground::SetOffset( const float &offsetX, const float &offsetY )
@@ -194,6 +277,9 @@ namespace Sonar
 		_offsetY = offsetY;
 
 		SetBackgroundPositions( );
+
+		if ( nullptr != _repeatedTexture )
+		{ UpdateRepeatedQuad( ); }
 	}
 
 	void ScrollingBackground::SetBackgroundPositions( )
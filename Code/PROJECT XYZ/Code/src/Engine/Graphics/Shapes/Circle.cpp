@@ -7,7 +7,7 @@ namespace Sonar
 		_object = &_shape;
 		_texture = std::make_shared<Texture>( );
 
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
     }
 
     Circle::Circle( GameDataRef data, const float &radius ) : Drawable( data )
@@ -20,7 +20,7 @@ namespace Sonar
         SetPosition( 0, 0 );
         SetSize( radius );
 		SetPointCount( 36 );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
     }
 
     Circle::~Circle( ) { }
@@ -37,7 +37,7 @@ namespace Sonar
 	void Circle::SetPointCount( const unsigned int &count )
 	{
 		_shape.setPointCount( count );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	int Circle::GetPointCount( ) const
@@ -47,7 +47,7 @@ namespace Sonar
 	{
 		Drawable::SetPosition( position );
 		_shape.setPosition( position.x, position.y );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Circle::SetPosition( const float &x, const float &y )
@@ -62,7 +62,7 @@ namespace Sonar
 	void Circle::SetSize( const float &radius )
 	{
 		Drawable::SetSize( radius * 2, radius * 2 );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Circle::SetInsideColor( const Color &color )
@@ -97,7 +97,7 @@ namespace Sonar
 	{
 		Drawable::Move( offset );
 		_shape.move( offset.x, offset.y );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Circle::Move( const float &x, const float &y )
@@ -113,7 +113,7 @@ namespace Sonar
 	{
 		Drawable::SetRotation( angle );
 		_shape.setRotation( angle );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Circle::Rotate( const float &angle )
@@ -126,7 +126,7 @@ namespace Sonar
 	{
 		Drawable::SetScale( scale[0], scale[1] );
 		_shape.setScale( scale[0], scale[1] );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Circle::SetScale( const float &xScale, const float &yScale )
@@ -154,7 +154,7 @@ namespace Sonar
 	{
 		Drawable::SetPivot( pivot );
 		_shape.setOrigin( pivot[0], pivot[1] );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Circle::SetPivot( const float &xPoint, const float &yPoint )
@@ -195,7 +195,7 @@ namespace Sonar
 				break;
 		}
 
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Circle::SetPivotX( const float &xPoint )
@@ -206,6 +206,10 @@ namespace Sonar
 
 	void Circle::Update( const float &dt )
 	{
+		// Only a pulse changes anything here, idle objects cost nothing per frame
+		if ( !IsPulsing( ) )
+		{ return; }
+
 		Drawable::Update( dt );
 
 		SetScale( Drawable::GetScale( ) );
@@ -243,7 +247,10 @@ namespace Sonar
 	{ return glm::vec4( _shape.getLocalBounds( ).left, _shape.getLocalBounds( ).top, _shape.getLocalBounds( ).width, _shape.getLocalBounds( ).height ); }
 
 	glm::vec4 Circle::GetGlobalBounds( ) const
-	{ return glm::vec4( _shape.getGlobalBounds( ).left, _shape.getGlobalBounds( ).top, _shape.getGlobalBounds( ).width, _shape.getGlobalBounds( ).height ); }
+	{ return Drawable::GetGlobalBounds( ); }
+
+	sf::FloatRect Circle::CalculateGlobalBounds( ) const
+	{ return _shape.getGlobalBounds( ); }
 
 }
 
@@ -8,7 +8,7 @@ namespace Sonar
 		_texture = std::make_shared<Texture>( );
 
         SetPosition( 0, 0 );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
     }
 
     Rectangle::Rectangle( GameDataRef data, const float &width, const float &height ) : Drawable( data )
@@ -18,7 +18,7 @@ namespace Sonar
 
         SetPosition( 0, 0 );
         SetSize( width, height );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
     }
 
     Rectangle::~Rectangle( ) { }
@@ -27,7 +27,7 @@ namespace Sonar
 	{
 		Drawable::SetPosition( position );
 		_shape.setPosition( position.x, position.y );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
     void Rectangle::SetPosition( const float &x, const float &y )
@@ -43,7 +43,7 @@ namespace Sonar
 	{
 		Drawable::SetSize( size );
 		_shape.setSize( sf::Vector2f( size.x, size.y ) );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
     void Rectangle::SetSize( const float &width, const float &height )
@@ -87,7 +87,7 @@ namespace Sonar
 	{
 		Drawable::Move( offset );
 		_shape.move( offset.x, offset.y );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Rectangle::Move( const float &x, const float &y )
@@ -103,7 +103,7 @@ namespace Sonar
 	{
 		Drawable::SetRotation( angle );
 		_shape.setRotation( angle );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Rectangle::Rotate( const float &angle )
@@ -116,7 +116,7 @@ namespace Sonar
 	{
 		Drawable::SetScale( scale[0], scale[1] );
 		_shape.setScale( scale[0], scale[1] );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Rectangle::SetScale( const float &xScale, const float &yScale )
@@ -144,7 +144,7 @@ namespace Sonar
 	{
 		Drawable::SetPivot( pivot );
 		_shape.setOrigin( pivot[0], pivot[1] );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Rectangle::SetPivot( const float &xPoint, const float &yPoint )
@@ -185,7 +185,7 @@ namespace Sonar
 				break;
 		}
 
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Rectangle::SetPivotX( const float &xPoint )
@@ -196,6 +196,10 @@ namespace Sonar
 
 	void Rectangle::Update( const float &dt )
 	{
+		// Only a pulse changes anything here, idle objects cost nothing per frame
+		if ( !IsPulsing( ) )
+		{ return; }
+
 		Drawable::Update( dt );
 
 		SetScale( Drawable::GetScale( ) );
@@ -233,7 +237,10 @@ namespace Sonar
 	{ return glm::vec4( _shape.getLocalBounds( ).left, _shape.getLocalBounds( ).top, _shape.getLocalBounds( ).width, _shape.getLocalBounds( ).height ); }
 
 	glm::vec4 Rectangle::GetGlobalBounds( ) const
-	{ return glm::vec4( _shape.getGlobalBounds( ).left, _shape.getGlobalBounds( ).top, _shape.getGlobalBounds( ).width, _shape.getGlobalBounds( ).height ); }
+	{ return Drawable::GetGlobalBounds( ); }
+
+	sf::FloatRect Rectangle::CalculateGlobalBounds( ) const
+	{ return _shape.getGlobalBounds( ); }
 
 }
 
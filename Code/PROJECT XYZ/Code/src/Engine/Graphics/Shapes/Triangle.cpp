@@ -11,7 +11,7 @@ namespace Sonar
 
 		SetInsideColor( Color::Black );
 		SetPosition( 0, 0 );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
     Triangle::Triangle( GameDataRef data, const glm::vec2 &point1, const glm::vec2 &point2, const glm::vec2 &point3 ) : Drawable( data )
@@ -25,7 +25,7 @@ namespace Sonar
 
 		SetInsideColor( Color::Black );
         SetPosition( 0, 0 );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
     }
 
     Triangle::~Triangle( ) { }
@@ -34,7 +34,7 @@ namespace Sonar
 	{
 		Drawable::SetPosition( position );
 		_shape.setPosition( position.x, position.y );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Triangle::SetPosition( const float &x, const float &y )
@@ -75,7 +75,7 @@ namespace Sonar
 		float height = yMax - yMin;
 
 		Drawable::SetSize( width, height );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Triangle::SetInsideColor( const Color &color )
@@ -110,7 +110,7 @@ namespace Sonar
 	{
 		Drawable::Move( offset );
 		_shape.move( offset.x, offset.y );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Triangle::Move( const float &x, const float &y )
@@ -126,7 +126,7 @@ namespace Sonar
 	{
 		Drawable::SetRotation( angle );
 		_shape.setRotation( angle );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Triangle::Rotate( const float &angle )
@@ -139,7 +139,7 @@ namespace Sonar
 	{
 		Drawable::SetScale( scale[0], scale[1] );
 		_shape.setScale( scale[0], scale[1] );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Triangle::SetScale( const float &xScale, const float &yScale )
@@ -167,7 +167,7 @@ namespace Sonar
 	{
 		Drawable::SetPivot( pivot );
 		_shape.setOrigin( pivot[0], pivot[1] );
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Triangle::SetPivot( const float &xPoint, const float &yPoint )
@@ -208,7 +208,7 @@ namespace Sonar
 				break;
 		}
 
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Triangle::SetPivotX( const float &xPoint )
@@ -219,6 +219,10 @@ namespace Sonar
 
 	void Triangle::Update( const float &dt )
 	{
+		// Only a pulse changes anything here, idle objects cost nothing per frame
+		if ( !IsPulsing( ) )
+		{ return; }
+
 		Drawable::Update( dt );
 
 		SetScale( Drawable::GetScale( ) );
@@ -236,7 +240,7 @@ namespace Sonar
 
 		SetSize( point1, point2, point3 );
 
-		_globalBounds = _shape.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	std::vector<glm::vec2> Triangle::GetPoints( )
@@ -274,7 +278,10 @@ namespace Sonar
 	{ return glm::vec4( _shape.getLocalBounds( ).left, _shape.getLocalBounds( ).top, _shape.getLocalBounds( ).width, _shape.getLocalBounds( ).height ); }
 
 	glm::vec4 Triangle::GetGlobalBounds( ) const
-	{ return glm::vec4( _shape.getGlobalBounds( ).left, _shape.getGlobalBounds( ).top, _shape.getGlobalBounds( ).width, _shape.getGlobalBounds( ).height ); }
+	{ return Drawable::GetGlobalBounds( ); }
+
+	sf::FloatRect Triangle::CalculateGlobalBounds( ) const
+	{ return _shape.getGlobalBounds( ); }
 
 }
 
@@ -151,6 +151,8 @@ namespace Sonar
 
 
 			SetPosition( _background->GetPosition( ) );
+
+			ReportVisualChange( );
 		}
 	}
 
@@ -335,6 +337,8 @@ namespace Sonar
 			_value = _maximumValue;
 			SetPosition( GetPosition( ) );
 		}
+
+		ReportVisualChange( );
 	}
 
 	const float &Slider::GetValue( ) const
@@ -7,7 +7,7 @@ namespace Sonar
 		_object = &_sprite;
 		_texture = std::make_shared<Texture>( );
 
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
     Sprite::Sprite( GameDataRef data, const std::string &filepath ) : Drawable( data )
@@ -16,7 +16,7 @@ namespace Sonar
 		_texture = std::make_shared<Texture>( );
 
 		SetTexture( filepath );
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	Sprite::Sprite( GameDataRef data, std::shared_ptr<Texture> texture ) : Drawable( data )
@@ -25,7 +25,7 @@ namespace Sonar
 
 		_texture = std::make_shared<Texture>( );
 		SetTexture( texture );
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	Sprite::~Sprite( ) { }
@@ -34,7 +34,7 @@ namespace Sonar
 	{
 		Drawable::SetPosition( position );
 		_sprite.setPosition( position.x, position.y );
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Sprite::SetPosition( const float &x, const float &y )
@@ -56,7 +56,7 @@ namespace Sonar
 	{
 		Drawable::Move( offset );
 		_sprite.move( offset.x, offset.y );
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Sprite::Move( const float &x, const float &y )
@@ -72,7 +72,7 @@ namespace Sonar
 	{
 		Drawable::SetRotation( angle );
 		_sprite.setRotation( angle );
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Sprite::Rotate( const float &angle )
@@ -85,7 +85,7 @@ namespace Sonar
 	{
 		Drawable::SetScale( scale[0], scale[1] );
 		_sprite.setScale( scale[0], scale[1] );
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Sprite::SetScale( const float &xScale, const float &yScale )
@@ -113,7 +113,7 @@ namespace Sonar
 	{
 		Drawable::SetPivot( pivot );
 		_sprite.setOrigin( pivot[0], pivot[1] );
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Sprite::SetPivot( const float &xPoint, const float &yPoint )
@@ -154,7 +154,7 @@ namespace Sonar
 				break;
 		}
 
-		_globalBounds = _sprite.getGlobalBounds( );
+		_isGlobalBoundsDirty = true;
 	}
 
 	void Sprite::SetPivotX( const float &xPoint )
@@ -165,6 +165,10 @@ namespace Sonar
 
 	void Sprite::Update( const float &dt )
 	{
+		// Only a pulse changes anything here, idle objects cost nothing per frame
+		if ( !IsPulsing( ) )
+		{ return; }
+
 		Drawable::Update( dt );
 
 		SetScale( Drawable::GetScale( ) );
@@ -172,7 +176,15 @@ namespace Sonar
 
 	void Sprite::SetTexture( const std::string &filepath, const bool &resetRect )
 	{
-		_texture->SetTexture( filepath );
+		if ( _data->assets.IsInTextureAtlas( filepath ) )
+		{
+			SetTexture( _data->assets.GetTextureAtlasRegion( filepath ) );
+
+			return;
+		}
+
+		// The current texture may be an atlas page or shared with other sprites, so take a handle of our own (the image itself comes from the texture cache)
+		_texture = std::make_shared<Texture>( filepath );
 		_sprite.setTexture( *_texture->GetTexture( ), resetRect );
 
 		SetPosition( _sprite.getPosition( ).x, _sprite.getPosition( ).y );
@@ -188,8 +200,21 @@ namespace Sonar
 		SetSize( _sprite.getLocalBounds( ).width, _sprite.getLocalBounds( ).height );
 	}
 
+	void Sprite::SetTexture( const TextureAtlas::Region &region )
+	{
+		_texture = region._page;
+		_sprite.setTexture( *_texture->GetTexture( ) );
+		SetTextureRect( region._rect );
+
+		SetPosition( _sprite.getPosition( ).x, _sprite.getPosition( ).y );
+		SetSize( _sprite.getLocalBounds( ).width, _sprite.getLocalBounds( ).height );
+	}
+
 	void Sprite::SetTextureRect( const glm::ivec4 &rectangle )
-	{ _sprite.setTextureRect( sf::IntRect( rectangle.x, rectangle.y, rectangle.z, rectangle.w ) ); }
+	{
+		_sprite.setTextureRect( sf::IntRect( rectangle.x, rectangle.y, rectangle.z, rectangle.w ) );
+		_isGlobalBoundsDirty = true;
+	}
 
 	void Sprite::SetTextureRect( const int &left, const int &top, const int &width, const int &height )
 	{ SetTextureRect( glm::ivec4( left, top, width, height ) ); }
@@ -204,10 +229,19 @@ namespace Sonar
 	{ return glm::vec4( _sprite.getLocalBounds( ).left, _sprite.getLocalBounds( ).top, _sprite.getLocalBounds( ).width, _sprite.getLocalBounds( ).height ); }
 
 	glm::vec4 Sprite::GetGlobalBounds( ) const
-	{ return glm::vec4( _sprite.getGlobalBounds( ).left, _sprite.getGlobalBounds( ).top, _sprite.getGlobalBounds( ).width, _sprite.getGlobalBounds( ).height ); }
+	{ return Drawable::GetGlobalBounds( ); }
+
+	sf::FloatRect Sprite::CalculateGlobalBounds( ) const
+	{ return _sprite.getGlobalBounds( ); }
 
 	bool Sprite::PixelPerfectCollisionCheck( const Sprite &object, const unsigned char &alphaLimit /*= 0 */ )
-	{ return Collision::PixelPerfectTest( _sprite, object.GetSFMLSprite( ), alphaLimit ); }
+	{
+		// Cheap rejection before the bitmasks are fetched
+		if ( !_sprite.getGlobalBounds( ).intersects( object._sprite.getGlobalBounds( ) ) )
+		{ return false; }
+
+		return Bitmask::Test( *_texture->GetBitmask( alphaLimit ), _sprite, *object._texture->GetBitmask( alphaLimit ), object._sprite );
+	}
 
 	const sf::Sprite &Sprite::GetSFMLSprite( ) const
 	{ return _sprite; }
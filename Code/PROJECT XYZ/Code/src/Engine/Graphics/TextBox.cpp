@@ -56,6 +56,8 @@ namespace Sonar
 
 				_clock.Reset( );
 				_isPostStringBlinkerShown = true;
+
+				ReportVisualChange( );
 			}
 		}
 	}
@@ -108,6 +110,8 @@ namespace Sonar
 
 	void TextBox::Update( const float &dt )
 	{
+		const bool wasBlinkerDrawn = _isPostStringBlinkerShown && _isFocusedOn;
+
 		_clickableRect->SetInsideColor( Color( 0, 0, 255, 100 ) );
 	
 		if ( GetWidth( ) > _minimumClickableSize.x )
@@ -153,6 +157,9 @@ namespace Sonar
 				}
 			}
 		}
+
+		if ( wasBlinkerDrawn != ( _isPostStringBlinkerShown && _isFocusedOn ) )
+		{ ReportVisualChange( ); }
 	}
 
 	void TextBox::Draw( )
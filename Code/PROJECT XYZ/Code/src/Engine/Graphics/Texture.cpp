@@ -3,28 +3,24 @@
 namespace Sonar
 {
 	Texture::Texture( )
-	{ _texture = new sf::Texture( ); }
+	{ _texture = std::make_shared<sf::Texture>( ); }
 
     Texture::Texture( const std::string &filepath )
-	{
-		_texture = new sf::Texture( );
-		_texture->loadFromFile( filepath );
-	}
+	{ SetTexture( filepath ); }
 
-	Texture::~Texture( )
-	{
-		delete _texture;
-		_texture = nullptr;
-	}
+	Texture::~Texture( ) { }
 
 	void Texture::SetTexture( const std::string &filepath )
-	{ _texture->loadFromFile( filepath ); }
+	{ _texture = TextureCache::getInstance( )->Load( filepath ); }
 
 	void Texture::SetTexture( const Texture &texture )
-	{ _texture = texture.GetTexture( ); }
+	{ _texture = texture._texture; }
+
+	void Texture::SetTexture( const std::string &filepath, const sf::Image &image )
+	{ _texture = TextureCache::getInstance( )->Load( filepath, image ); }
 
 	sf::Texture *Texture::GetTexture( ) const
-	{ return _texture; }
+	{ return _texture.get( ); }
 
 	glm::vec2 Texture::GetSize( ) const
 	{ return glm::vec2( _texture->getSize( ).x, _texture->getSize( ).y ); }
@@ -35,5 +31,8 @@ namespace Sonar
 	bool Texture::IsRepeated( ) const
 	{ return _texture->isRepeated( ); }
 
+	std::shared_ptr<const Bitmask> Texture::GetBitmask( const unsigned char &alphaLimit ) const
+	{ return TextureCache::getInstance( )->GetBitmask( _texture, alphaLimit ); }
+
 }
 
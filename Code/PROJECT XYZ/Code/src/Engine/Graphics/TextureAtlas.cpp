@@ -0,0 +1,202 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	TextureAtlas::TextureAtlas( const unsigned int &pageSize, const unsigned int &padding )
+	{
+		_pageSize = pageSize;
+		_padding = padding;
+	}
+
+	TextureAtlas::~TextureAtlas( ) { }
+
+	bool TextureAtlas::AddImage( const std::string &name, const sf::Image &image )
+	{
+		if ( HasRegion( name ) )
+		{ return true; }
+
+		const unsigned int width = image.getSize( ).x;
+		const unsigned int height = image.getSize( ).y;
+
+		// The page size can only be clamped once there is a GPU context, which there is by the time images are loaded
+		_pageSize = std::min( _pageSize, sf::Texture::getMaximumSize( ) );
+
+		if ( 0 == width || 0 == height || width > _pageSize || height > _pageSize )
+		{ return false; }
+
+		glm::uvec2 position;
+		unsigned int pageIndex = 0;
+		bool isAllocated = false;
+
+		for ( ; pageIndex < _pages.size( ) && !isAllocated; pageIndex++ )
+		{ isAllocated = Allocate( _pages.at( pageIndex ), width, height, position ); }
+
+		if ( isAllocated )
+		{ pageIndex--; }
+		else
+		{
+			AddPage( );
+			pageIndex = _pages.size( ) - 1;
+
+			if ( !Allocate( _pages.at( pageIndex ), width, height, position ) )
+			{ return false; }
+		}
+
+		Page &page = _pages.at( pageIndex );
+		page._texture->GetTexture( )->update( image, position.x, position.y );
+
+		Region region;
+		region._page = page._texture;
+		region._pageIndex = pageIndex;
+		region._rect = glm::ivec4( position.x, position.y, width, height );
+
+		_regions[name] = region;
+
+		return true;
+	}
+
+	bool TextureAtlas::AddImage( const std::string &name, const std::string &filepath )
+	{
+		sf::Image image;
+
+		if ( !image.loadFromFile( filepath ) )
+		{ return false; }
+
+		return AddImage( name, image );
+	}
+
+	bool TextureAtlas::LoadFromFile( const std::string &filepath )
+	{
+		std::ifstream file( filepath );
+
+		if ( !file.is_open( ) )
+		{ return false; }
+
+		nlohmann::json atlasData = nlohmann::json::parse( file, nullptr, false );
+
+		if ( atlasData.is_discarded( ) || !atlasData.contains( "pages" ) || !atlasData.contains( "regions" ) )
+		{ return false; }
+
+		// Pages are checked before any are added, as region page indices count from the first one
+		for ( const auto &pagePath : atlasData["pages"] )
+		{
+			if ( !pagePath.is_string( ) )
+			{ return false; }
+		}
+
+		const std::filesystem::path directory = std::filesystem::path( filepath ).parent_path( );
+		const unsigned int firstPage = _pages.size( );
+		bool isValid = true;
+
+		for ( const auto &pagePath : atlasData["pages"] )
+		{
+			Page page;
+			page._texture = std::make_shared<Texture>( ( directory / pagePath.get<std::string>( ) ).string( ) );
+			page._usedHeight = 0;
+			page._isPacked = false;
+
+			_pages.push_back( page );
+		}
+
+		for ( const auto &element : atlasData["regions"].items( ) )
+		{
+			const auto &values = element.value( );
+			Region region;
+
+			// A malformed region is skipped rather than letting the exception out of the asset manager
+			try
+			{
+				region._pageIndex = firstPage + values.at( 0 ).get<unsigned int>( );
+				region._rect = glm::ivec4( values.at( 1 ).get<int>( ), values.at( 2 ).get<int>( ), values.at( 3 ).get<int>( ), values.at( 4 ).get<int>( ) );
+			}
+			catch ( const nlohmann::json::exception & )
+			{
+				isValid = false;
+
+				continue;
+			}
+
+			if ( region._pageIndex >= _pages.size( ) )
+			{
+				isValid = false;
+
+				continue;
+			}
+
+			region._page = _pages.at( region._pageIndex )._texture;
+
+			_regions[element.key( )] = region;
+		}
+
+		return isValid;
+	}
+
+	bool TextureAtlas::HasRegion( const std::string &name ) const
+	{ return _regions.find( name ) != _regions.end( ); }
+
+	const TextureAtlas::Region &TextureAtlas::GetRegion( const std::string &name ) const
+	{ return _regions.at( name ); }
+
+	unsigned int TextureAtlas::GetPageCount( ) const
+	{ return _pages.size( ); }
+
+	std::shared_ptr<Texture> TextureAtlas::GetPage( const unsigned int &index ) const
+	{ return _pages.at( index )._texture; }
+
+	bool TextureAtlas::Allocate( Page &page, const unsigned int &width, const unsigned int &height, glm::uvec2 &position )
+	{
+		if ( !page._isPacked )
+		{ return false; }
+
+		const unsigned int paddedWidth = width + _padding;
+		const unsigned int paddedHeight = height + _padding;
+
+		// Use the shortest existing shelf the image fits on to waste as little height as possible
+		Shelf *bestShelf = nullptr;
+
+		for ( auto &shelf : page._shelves )
+		{
+			if ( shelf._height >= paddedHeight && shelf._cursor + paddedWidth <= _pageSize )
+			{
+				if ( nullptr == bestShelf || shelf._height < bestShelf->_height )
+				{ bestShelf = &shelf; }
+			}
+		}
+
+		if ( nullptr == bestShelf )
+		{
+			if ( page._usedHeight + paddedHeight > _pageSize + _padding )
+			{ return false; }
+
+			Shelf shelf;
+			shelf._top = page._usedHeight;
+			shelf._height = paddedHeight;
+			shelf._cursor = 0;
+
+			page._shelves.push_back( shelf );
+			page._usedHeight += paddedHeight;
+
+			bestShelf = &page._shelves.back( );
+		}
+
+		position = glm::uvec2( bestShelf->_cursor, bestShelf->_top );
+		bestShelf->_cursor += paddedWidth;
+
+		return true;
+	}
+
+	void TextureAtlas::AddPage( )
+	{
+		Page page;
+		page._texture = std::make_shared<Texture>( );
+
+		// A created texture's contents are undefined, start from transparent so padding and unused space can't bleed into filtered edges
+		sf::Image image;
+		image.create( _pageSize, _pageSize, sf::Color::Transparent );
+		page._texture->GetTexture( )->loadFromImage( image );
+		page._usedHeight = 0;
+		page._isPacked = true;
+
+		_pages.push_back( page );
+	}
+}
@@ -0,0 +1,359 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+    TextureCache *TextureCache::getInstance( )
+    {
+        // Loader threads can ask for the cache at the same time as the main thread, a local static is only constructed once
+        static TextureCache instance;
+
+        return &instance;
+    }
+
+    static const char DISK_CACHE_MAGIC[4] = { 'S', 'R', 'G', 'B' };
+
+    TextureCache::TextureCache( )
+    {
+        _isDiskCacheEnabled = DEFAULT_IS_IMAGE_DISK_CACHE_ENABLED;
+        _diskCacheDirectory = DEFAULT_IMAGE_DISK_CACHE_DIRECTORY;
+
+        static_assert( sizeof( DiskCacheHeader ) == 32, "Disk cache header must match the file layout" );
+    }
+
+    std::shared_ptr<sf::Texture> TextureCache::Load( const std::string &filepath )
+    {
+        const PathKey key = GetPathKey( filepath );
+
+        if ( auto texture = _texturesByPath[key].lock( ) )
+        { return texture; }
+
+        for ( auto it = _archives.rbegin( ); it != _archives.rend( ); it++ )
+        {
+            AssetArchive::Entry entry;
+
+            if ( ( *it )->GetEntry( filepath, entry ) )
+            {
+                sf::Image image;
+                image.loadFromMemory( entry._data, entry._size );
+
+                return Load( filepath, image );
+            }
+        }
+
+        // With the disk cache the source file isn't read at all on a hit, so textures are only shared by path
+        if ( _isDiskCacheEnabled )
+        {
+            sf::Image image;
+            DecodeImage( filepath, image );
+
+            return Load( filepath, image );
+        }
+
+        Prune( );
+
+        const std::vector<char> data = ReadFile( filepath );
+        std::shared_ptr<sf::Texture> texture;
+
+        // Only a file of the same size can be a copy, so most loads never hash anything
+        const auto sameSize = _texturesBySize.equal_range( data.size( ) );
+        const bool isHashed = sameSize.first != sameSize.second;
+        const std::uint64_t hash = isHashed ? Hash( data.data( ), data.size( ) ) : 0;
+
+        for ( auto it = sameSize.first; it != sameSize.second && !texture; it++ )
+        {
+            ContentEntry &entry = it->second;
+
+            if ( !entry._isHashed )
+            {
+                const std::vector<char> bytes = ReadFile( entry._filepath );
+
+                entry._hash = Hash( bytes.data( ), bytes.size( ) );
+                entry._isHashed = true;
+            }
+
+            // The hash only rules files out, a match is confirmed byte for byte so different images never share
+            if ( entry._hash == hash && data == ReadFile( entry._filepath ) )
+            { texture = entry._texture.lock( ); }
+        }
+
+        if ( !texture )
+        {
+            texture = std::make_shared<sf::Texture>( );
+
+            // Missing or broken files still get an (empty) texture, matching sf::Texture::loadFromFile
+            if ( !data.empty( ) )
+            { texture->loadFromMemory( data.data( ), data.size( ) ); }
+
+            _texturesBySize.emplace( data.size( ), ContentEntry { filepath, texture, hash, isHashed } );
+        }
+
+        _texturesByPath[key] = texture;
+
+        return texture;
+    }
+
+    std::shared_ptr<sf::Texture> TextureCache::Load( const std::string &filepath, const sf::Image &image )
+    {
+        const PathKey key = GetPathKey( filepath );
+
+        if ( auto texture = _texturesByPath[key].lock( ) )
+        { return texture; }
+
+        Prune( );
+
+        auto texture = std::make_shared<sf::Texture>( );
+        texture->loadFromImage( image );
+
+        _texturesByPath[key] = texture;
+
+        return texture;
+    }
+
+    unsigned int TextureCache::GetTextureCount( )
+    {
+        Prune( );
+
+        std::set<sf::Texture *> textures;
+
+        for ( const auto &entry : _texturesByPath )
+        { textures.insert( entry.second.lock( ).get( ) ); }
+
+        return textures.size( );
+    }
+
+    void TextureCache::AddArchive( AssetArchive *archive )
+    { _archives.push_back( archive ); }
+
+    void TextureCache::RemoveArchive( AssetArchive *archive )
+    { _archives.erase( std::remove( _archives.begin( ), _archives.end( ), archive ), _archives.end( ) ); }
+
+    std::shared_ptr<const Bitmask> TextureCache::GetBitmask( const std::shared_ptr<sf::Texture> &texture, const unsigned char &alphaLimit )
+    {
+        const auto key = std::make_pair( texture.get( ), alphaLimit );
+        const auto found = _bitmasks.find( key );
+
+        if ( _bitmasks.end( ) != found && found->second._texture.lock( ) == texture )
+        { return found->second._bitmask; }
+
+        Prune( );
+
+        BitmaskEntry &entry = _bitmasks[key];
+
+        // Reading a texture back from the GPU is slow, which is why this only happens once per texture
+        entry._texture = texture;
+        entry._bitmask = std::make_shared<const Bitmask>( texture->copyToImage( ), alphaLimit );
+
+        return entry._bitmask;
+    }
+
+    std::string TextureCache::GetKey( const std::string &filepath )
+    {
+        std::error_code error;
+        const std::filesystem::path path = std::filesystem::weakly_canonical( filepath, error );
+
+        return error ? filepath : path.string( );
+    }
+
+    TextureCache::PathKey TextureCache::GetPathKey( const std::string &filepath )
+    {
+        std::uint64_t size = 0;
+        std::int64_t time = 0;
+
+        // A file that can't be read is keyed by its path alone
+        GetFileStamp( filepath, size, time );
+
+        return PathKey( GetKey( filepath ), size, time );
+    }
+
+    bool TextureCache::GetFileStamp( const std::string &filepath, std::uint64_t &size, std::int64_t &time )
+    {
+        std::error_code sizeError, timeError;
+        const std::uint64_t fileSize = std::filesystem::file_size( filepath, sizeError );
+        const std::int64_t fileTime = std::filesystem::last_write_time( filepath, timeError ).time_since_epoch( ).count( );
+
+        if ( sizeError || timeError )
+        { return false; }
+
+        size = fileSize;
+        time = fileTime;
+
+        return true;
+    }
+
+    std::vector<char> TextureCache::ReadFile( const std::string &filepath )
+    {
+        std::ifstream file( filepath, std::ios::binary );
+
+        return std::vector<char>( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>( ) );
+    }
+
+    bool TextureCache::DecodeImage( const std::string &filepath, sf::Image &image ) const
+    {
+        if ( !_isDiskCacheEnabled )
+        { return image.loadFromFile( filepath ); }
+
+        std::uint64_t sourceSize;
+        std::int64_t sourceTime;
+
+        if ( !GetFileStamp( filepath, sourceSize, sourceTime ) )
+        { return image.loadFromFile( filepath ); }
+
+        const std::string cachePath = GetDiskCachePath( filepath, sourceSize, sourceTime );
+
+        if ( ReadDiskCache( cachePath, sourceSize, sourceTime, image ) )
+        { return true; }
+
+        if ( !image.loadFromFile( filepath ) )
+        { return false; }
+
+        WriteDiskCache( cachePath, sourceSize, sourceTime, image );
+
+        return true;
+    }
+
+    void TextureCache::EnableDiskCache( )
+    { _isDiskCacheEnabled = true; }
+
+    void TextureCache::DisableDiskCache( )
+    { _isDiskCacheEnabled = false; }
+
+    bool TextureCache::IsDiskCacheEnabled( ) const
+    { return _isDiskCacheEnabled; }
+
+    void TextureCache::SetDiskCacheDirectory( const std::string &directory )
+    {
+        std::lock_guard<std::mutex> lock( _diskCacheMutex );
+
+        _diskCacheDirectory = directory;
+    }
+
+    std::string TextureCache::GetDiskCacheDirectory( ) const
+    {
+        std::lock_guard<std::mutex> lock( _diskCacheMutex );
+
+        return _diskCacheDirectory;
+    }
+
+    std::uint64_t TextureCache::Hash( const char *data, const std::size_t &size )
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+
+        for ( std::size_t i = 0; i < size; i++ )
+        {
+            hash ^= static_cast<unsigned char>( data[i] );
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    std::string TextureCache::GetDiskCachePath( const std::string &filepath, const std::uint64_t &sourceSize, const std::int64_t &sourceTime ) const
+    {
+        const std::string key = GetKey( filepath ) + "|" + std::to_string( sourceSize ) + "|" + std::to_string( sourceTime );
+
+        std::stringstream fileName;
+        fileName << std::hex << std::setw( 16 ) << std::setfill( '0' ) << Hash( key.data( ), key.size( ) ) << ".rgba";
+
+        return ( std::filesystem::path( GetDiskCacheDirectory( ) ) / fileName.str( ) ).string( );
+    }
+
+    bool TextureCache::ReadDiskCache( const std::string &cachePath, const std::uint64_t &sourceSize, const std::int64_t &sourceTime, sf::Image &image )
+    {
+        std::ifstream file( cachePath, std::ios::binary | std::ios::ate );
+
+        if ( !file.is_open( ) )
+        { return false; }
+
+        const std::uint64_t fileSize = static_cast<std::uint64_t>( file.tellg( ) );
+        file.seekg( 0 );
+
+        DiskCacheHeader header;
+
+        if ( !file.read( reinterpret_cast<char *>( &header ), sizeof( DiskCacheHeader ) ) )
+        { return false; }
+
+        // The header repeats the key so a hash collision or a stale file is never used
+        if ( 0 != std::memcmp( header._magic, DISK_CACHE_MAGIC, sizeof( DISK_CACHE_MAGIC ) ) || header._sourceSize != sourceSize || header._sourceTime != sourceTime )
+        { return false; }
+
+        // A corrupt or truncated file is rejected before its size is trusted, it can ask for more pixels than it holds or a texture could use
+        const std::uint64_t maximumSize = sf::Texture::getMaximumSize( );
+        const std::uint64_t pixelBytes = static_cast<std::uint64_t>( header._width ) * header._height * 4;
+
+        if ( header._width > maximumSize || header._height > maximumSize || pixelBytes != fileSize - sizeof( DiskCacheHeader ) )
+        { return false; }
+
+        std::vector<sf::Uint8> pixels( static_cast<std::size_t>( pixelBytes ) );
+
+        if ( !file.read( reinterpret_cast<char *>( pixels.data( ) ), pixels.size( ) ) )
+        { return false; }
+
+        image.create( header._width, header._height, pixels.data( ) );
+
+        return true;
+    }
+
+    void TextureCache::WriteDiskCache( const std::string &cachePath, const std::uint64_t &sourceSize, const std::int64_t &sourceTime, const sf::Image &image )
+    {
+        std::error_code error;
+        std::filesystem::create_directories( std::filesystem::path( cachePath ).parent_path( ), error );
+
+        DiskCacheHeader header;
+        std::memcpy( header._magic, DISK_CACHE_MAGIC, sizeof( DISK_CACHE_MAGIC ) );
+        header._width = image.getSize( ).x;
+        header._height = image.getSize( ).y;
+        header._reserved = 0;
+        header._sourceSize = sourceSize;
+        header._sourceTime = sourceTime;
+
+        // Written under a temporary name and renamed, so a reader (or another loader thread) never sees a partial file
+        const std::string temporaryPath = cachePath + "." + std::to_string( std::hash<std::thread::id>( )( std::this_thread::get_id( ) ) ) + ".tmp";
+
+        {
+            std::ofstream file( temporaryPath, std::ios::binary );
+
+            file.write( reinterpret_cast<const char *>( &header ), sizeof( DiskCacheHeader ) );
+            file.write( reinterpret_cast<const char *>( image.getPixelsPtr( ) ), static_cast<std::size_t>( header._width ) * header._height * 4 );
+
+            if ( !file.good( ) )
+            {
+                file.close( );
+                std::filesystem::remove( temporaryPath, error );
+
+                return;
+            }
+        }
+
+        std::filesystem::rename( temporaryPath, cachePath, error );
+
+        if ( error )
+        { std::filesystem::remove( temporaryPath, error ); }
+    }
+
+    void TextureCache::Prune( )
+    {
+        for ( auto it = _texturesByPath.begin( ); it != _texturesByPath.end( ); )
+        {
+            if ( it->second.expired( ) )
+            { it = _texturesByPath.erase( it ); }
+            else
+            { it++; }
+        }
+
+        for ( auto it = _texturesBySize.begin( ); it != _texturesBySize.end( ); )
+        {
+            if ( it->second._texture.expired( ) )
+            { it = _texturesBySize.erase( it ); }
+            else
+            { it++; }
+        }
+
+        for ( auto it = _bitmasks.begin( ); it != _bitmasks.end( ); )
+        {
+            if ( it->second._texture.expired( ) )
+            { it = _bitmasks.erase( it ); }
+            else
+            { it++; }
+        }
+    }
+}
@@ -0,0 +1,206 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	TileMap::TileMap( GameDataRef data, MapManager &map, const glm::vec2 &tileSize, const unsigned int &chunkSize ) : _data( data )
+	{
+		_map = &map;
+		_map->_tileMaps.push_back( this );
+
+		_texture = std::make_shared<Texture>( );
+		_textureOffset = glm::ivec2( 0, 0 );
+		_tiles.fill( glm::ivec4( 0, 0, 0, 0 ) );
+
+		_position = glm::vec2( 0, 0 );
+		_tileSize = tileSize;
+		_chunkSize = std::max( 1u, chunkSize );
+
+		OnMapChanged( );
+	}
+
+	TileMap::~TileMap( )
+	{
+		if ( nullptr != _map )
+		{
+			auto &tileMaps = _map->_tileMaps;
+			tileMaps.erase( std::remove( tileMaps.begin( ), tileMaps.end( ), this ), tileMaps.end( ) );
+		}
+	}
+
+	void TileMap::Draw( )
+	{
+		if ( _chunks.empty( ) )
+		{ return; }
+
+		const glm::vec4 view = _data->renderQueue.GetViewBounds( );
+		const glm::vec2 chunkWorldSize = _tileSize * static_cast<float>( _chunkSize );
+
+		// Chunks covering the view, everything outside the range is skipped without looking at it
+		const glm::ivec2 first( std::floor( ( view.x - _position.x ) / chunkWorldSize.x ), std::floor( ( view.y - _position.y ) / chunkWorldSize.y ) );
+		const glm::ivec2 last( std::floor( ( view.x + view.z - _position.x ) / chunkWorldSize.x ), std::floor( ( view.y + view.w - _position.y ) / chunkWorldSize.y ) );
+
+		const int firstX = std::max( 0, first.x ), firstY = std::max( 0, first.y );
+		const int lastX = std::min( last.x, static_cast<int>( _chunkCount.x ) - 1 ), lastY = std::min( last.y, static_cast<int>( _chunkCount.y ) - 1 );
+
+		unsigned int drawn = 0;
+
+		for ( int y = firstY; y <= lastY; y++ )
+		{
+			for ( int x = firstX; x <= lastX; x++ )
+			{
+				Chunk &chunk = _chunks[( y * _chunkCount.x ) + x];
+
+				if ( chunk._isDirty )
+				{ BuildChunk( x, y ); }
+
+				if ( 0 < chunk._vertices.getVertexCount( ) )
+				{ _data->renderQueue.SubmitTriangles( &chunk._vertices[0], chunk._vertices.getVertexCount( ), chunk._texture, 0, 0.0f, sf::BlendAlpha, chunk._transform ); }
+
+				drawn++;
+			}
+		}
+
+		_data->renderQueue.AddCulled( _chunks.size( ) - drawn );
+	}
+
+	void TileMap::SetTexture( const std::string &filepath )
+	{
+		if ( _data->assets.IsInTextureAtlas( filepath ) )
+		{
+			SetTexture( _data->assets.GetTextureAtlasRegion( filepath ) );
+
+			return;
+		}
+
+		SetTexture( std::make_shared<Texture>( filepath ) );
+	}
+
+	void TileMap::SetTexture( std::shared_ptr<Texture> texture )
+	{
+		_texture = texture;
+		_textureOffset = glm::ivec2( 0, 0 );
+
+		Rebuild( );
+	}
+
+	void TileMap::SetTexture( const TextureAtlas::Region &region )
+	{
+		_texture = region._page;
+		_textureOffset = glm::ivec2( region._rect.x, region._rect.y );
+
+		Rebuild( );
+	}
+
+	std::shared_ptr<Texture> TileMap::GetTexture( ) const
+	{ return _texture; }
+
+	void TileMap::SetTile( const char &value, const glm::ivec4 &rectangle )
+	{
+		_tiles[static_cast<unsigned char>( value )] = rectangle;
+
+		Rebuild( );
+	}
+
+	void TileMap::SetTile( const char &value, const int &left, const int &top, const int &width, const int &height )
+	{ SetTile( value, glm::ivec4( left, top, width, height ) ); }
+
+	void TileMap::RemoveTile( const char &value )
+	{ SetTile( value, glm::ivec4( 0, 0, 0, 0 ) ); }
+
+	const glm::ivec4 &TileMap::GetTile( const char &value ) const
+	{ return _tiles[static_cast<unsigned char>( value )]; }
+
+	void TileMap::SetPosition( const glm::vec2 &position )
+	{
+		_position = position;
+
+		// Chunks are built relative to the map, moving it only moves their transforms
+		for ( auto &chunk : _chunks )
+		{ chunk._transform = sf::Transform( ).translate( _position.x, _position.y ); }
+	}
+
+	void TileMap::SetPosition( const float &x, const float &y )
+	{ SetPosition( glm::vec2( x, y ) ); }
+
+	const glm::vec2 &TileMap::GetPosition( ) const
+	{ return _position; }
+
+	void TileMap::SetTileSize( const glm::vec2 &tileSize )
+	{
+		_tileSize = tileSize;
+
+		Rebuild( );
+	}
+
+	const glm::vec2 &TileMap::GetTileSize( ) const
+	{ return _tileSize; }
+
+	const glm::uvec2 &TileMap::GetChunkCount( ) const
+	{ return _chunkCount; }
+
+	void TileMap::Rebuild( )
+	{
+		for ( auto &chunk : _chunks )
+		{ chunk._isDirty = true; }
+	}
+
+	void TileMap::OnTileChanged( const unsigned int &x, const unsigned int &y )
+	{
+		const unsigned int chunkX = x / _chunkSize, chunkY = y / _chunkSize;
+
+		if ( chunkX < _chunkCount.x && chunkY < _chunkCount.y )
+		{ _chunks[( chunkY * _chunkCount.x ) + chunkX]._isDirty = true; }
+	}
+
+	void TileMap::OnMapChanged( )
+	{
+		const glm::uvec2 mapSize = nullptr != _map ? _map->GetSize( ) : glm::uvec2( 0, 0 );
+
+		_chunkCount = ( mapSize + glm::uvec2( _chunkSize - 1 ) ) / _chunkSize;
+
+		_chunks.clear( );
+		_chunks.resize( _chunkCount.x * _chunkCount.y );
+
+		SetPosition( _position );
+	}
+
+	void TileMap::BuildChunk( const unsigned int &x, const unsigned int &y )
+	{
+		Chunk &chunk = _chunks[( y * _chunkCount.x ) + x];
+
+		chunk._vertices.clear( );
+		chunk._texture = _texture->GetTexture( );
+		chunk._isDirty = false;
+
+		if ( nullptr == _map )
+		{ return; }
+
+		const glm::uvec2 mapSize = _map->GetSize( );
+		const unsigned int endX = std::min( ( x + 1 ) * _chunkSize, mapSize.x );
+		const unsigned int endY = std::min( ( y + 1 ) * _chunkSize, mapSize.y );
+
+		for ( unsigned int tileY = y * _chunkSize; tileY < endY; tileY++ )
+		{
+			for ( unsigned int tileX = x * _chunkSize; tileX < endX; tileX++ )
+			{
+				const glm::ivec4 &rectangle = _tiles[static_cast<unsigned char>( _map->GetValue( tileX, tileY ) )];
+
+				if ( 0 == rectangle.z || 0 == rectangle.w )
+				{ continue; }
+
+				const float left = tileX * _tileSize.x, top = tileY * _tileSize.y;
+				const float right = left + _tileSize.x, bottom = top + _tileSize.y;
+
+				const float textureLeft = static_cast<float>( _textureOffset.x + rectangle.x ), textureTop = static_cast<float>( _textureOffset.y + rectangle.y );
+				const float textureRight = textureLeft + rectangle.z, textureBottom = textureTop + rectangle.w;
+
+				chunk._vertices.append( sf::Vertex( sf::Vector2f( left, top ), sf::Vector2f( textureLeft, textureTop ) ) );
+				chunk._vertices.append( sf::Vertex( sf::Vector2f( right, top ), sf::Vector2f( textureRight, textureTop ) ) );
+				chunk._vertices.append( sf::Vertex( sf::Vector2f( right, bottom ), sf::Vector2f( textureRight, textureBottom ) ) );
+				chunk._vertices.append( sf::Vertex( sf::Vector2f( left, top ), sf::Vector2f( textureLeft, textureTop ) ) );
+				chunk._vertices.append( sf::Vertex( sf::Vector2f( right, bottom ), sf::Vector2f( textureRight, textureBottom ) ) );
+				chunk._vertices.append( sf::Vertex( sf::Vector2f( left, bottom ), sf::Vector2f( textureLeft, textureBottom ) ) );
+			}
+		}
+	}
+}
@@ -23,11 +23,12 @@ namespace Sonar
 
 	void View::Draw( )
 	{
-		_data->window.SetView( View( _data, *_view ) );
+		// Set through the render queue so it is recorded with the frame when the game is threaded
+		_data->renderQueue.SetView( *_view );
 
 		// DRAW ALL THE OBJECTS IN THE VIEW SET ABOVE
 		
-		_data->window.SetDefaultView( );
+		_data->renderQueue.SetDefaultView( );
 	}
 
 	void View::Update( const float &dt ) { }
@@ -0,0 +1,436 @@
+#include "pch.hpp"
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Sonar
+{
+	static const char ARCHIVE_MAGIC[4] = { 'S', 'P', 'A', 'K' };
+	static const std::uint32_t ARCHIVE_VERSION = 1;
+
+	AssetArchive::AssetArchive( )
+	{
+		_data = nullptr;
+		_size = 0;
+
+		static_assert( sizeof( Header ) == 16 && sizeof( IndexEntry ) == 32, "Archive records must match the file layout" );
+	}
+
+	AssetArchive::~AssetArchive( )
+	{ Close( ); }
+
+	bool AssetArchive::Pack( const std::string &directory, const std::string &fileName, const bool &compress )
+	{
+		struct PackedFile
+		{
+			std::string _name;
+			std::vector<char> _data;
+			std::uint64_t _size;
+			std::uint16_t _flags;
+		};
+
+		std::vector<PackedFile> files;
+		std::error_code error;
+
+		for ( const auto &item : std::filesystem::recursive_directory_iterator( directory, error ) )
+		{
+			if ( !item.is_regular_file( ) )
+			{ continue; }
+
+			std::ifstream input( item.path( ), std::ios::binary );
+
+			PackedFile file;
+			file._name = GetEntryName( item.path( ).string( ) );
+			file._data.assign( std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>( ) );
+			file._size = file._data.size( );
+			file._flags = 0;
+
+			if ( compress && !file._data.empty( ) )
+			{
+				std::vector<char> compressed = CompressLZ4( file._data.data( ), file._data.size( ) );
+
+				if ( compressed.size( ) < file._data.size( ) )
+				{
+					file._data = std::move( compressed );
+					file._flags |= FLAGS::LZ4;
+				}
+			}
+
+			files.push_back( std::move( file ) );
+		}
+
+		if ( error )
+		{ return false; }
+
+		std::sort( files.begin( ), files.end( ), []( const PackedFile &a, const PackedFile &b ) { return a._name < b._name; } );
+
+		Header header;
+		std::memcpy( header._magic, ARCHIVE_MAGIC, sizeof( ARCHIVE_MAGIC ) );
+		header._version = ARCHIVE_VERSION;
+		header._entryCount = files.size( );
+		header._reserved = 0;
+
+		std::vector<IndexEntry> index( files.size( ) );
+		std::uint64_t offset = sizeof( Header ) + ( sizeof( IndexEntry ) * files.size( ) );
+
+		for ( unsigned int i = 0; i < files.size( ); i++ )
+		{
+			index[i]._nameOffset = static_cast<std::uint32_t>( offset );
+			index[i]._nameLength = static_cast<std::uint16_t>( files[i]._name.size( ) );
+			offset += files[i]._name.size( );
+		}
+
+		for ( unsigned int i = 0; i < files.size( ); i++ )
+		{
+			index[i]._dataOffset = offset;
+			index[i]._storedSize = files[i]._data.size( );
+			index[i]._size = files[i]._size;
+			index[i]._flags = files[i]._flags;
+			offset += files[i]._data.size( );
+		}
+
+		std::ofstream output( fileName, std::ios::binary );
+
+		if ( !output.is_open( ) )
+		{ return false; }
+
+		output.write( reinterpret_cast<const char *>( &header ), sizeof( Header ) );
+		output.write( reinterpret_cast<const char *>( index.data( ) ), sizeof( IndexEntry ) * index.size( ) );
+
+		for ( const auto &file : files )
+		{ output.write( file._name.data( ), file._name.size( ) ); }
+
+		for ( const auto &file : files )
+		{ output.write( file._data.data( ), file._data.size( ) ); }
+
+		return output.good( );
+	}
+
+	bool AssetArchive::Open( const std::string &fileName )
+	{
+		Close( );
+
+#ifdef _WIN32
+		HANDLE file = CreateFileA( fileName.c_str( ), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+
+		if ( INVALID_HANDLE_VALUE == file )
+		{ return false; }
+
+		LARGE_INTEGER fileSize;
+		GetFileSizeEx( file, &fileSize );
+
+		HANDLE mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+
+		// The view keeps the mapping alive, so the handles aren't needed past this point
+		CloseHandle( file );
+
+		if ( nullptr == mapping )
+		{ return false; }
+
+		_data = static_cast<const char *>( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+		_size = static_cast<std::size_t>( fileSize.QuadPart );
+
+		CloseHandle( mapping );
+#else
+		const int file = open( fileName.c_str( ), O_RDONLY );
+
+		if ( file < 0 )
+		{ return false; }
+
+		struct stat fileStats;
+		fstat( file, &fileStats );
+
+		void *data = fileStats.st_size > 0 ? mmap( nullptr, fileStats.st_size, PROT_READ, MAP_PRIVATE, file, 0 ) : MAP_FAILED;
+
+		// The mapping stays valid once the file is closed
+		close( file );
+
+		_data = MAP_FAILED == data ? nullptr : static_cast<const char *>( data );
+		_size = static_cast<std::size_t>( fileStats.st_size );
+#endif
+
+		if ( nullptr == _data )
+		{
+			_size = 0;
+
+			return false;
+		}
+
+		Header header;
+
+		if ( _size < sizeof( Header ) )
+		{
+			Close( );
+
+			return false;
+		}
+
+		std::memcpy( &header, _data, sizeof( Header ) );
+
+		if ( 0 != std::memcmp( header._magic, ARCHIVE_MAGIC, sizeof( ARCHIVE_MAGIC ) ) || ARCHIVE_VERSION != header._version || _size < sizeof( Header ) + ( sizeof( IndexEntry ) * header._entryCount ) )
+		{
+			Close( );
+
+			return false;
+		}
+
+		// Every name and data range must lie inside the file, a truncated or corrupt archive would otherwise be read past its end
+		for ( std::uint32_t i = 0; i < header._entryCount; i++ )
+		{
+			IndexEntry record;
+			std::memcpy( &record, _data + sizeof( Header ) + ( sizeof( IndexEntry ) * i ), sizeof( IndexEntry ) );
+
+			if ( std::uint64_t( record._nameOffset ) + record._nameLength > _size || record._dataOffset > _size || record._storedSize > _size - record._dataOffset )
+			{
+				Close( );
+
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void AssetArchive::Close( )
+	{
+		if ( nullptr != _data )
+		{
+#ifdef _WIN32
+			UnmapViewOfFile( _data );
+#else
+			munmap( const_cast<char *>( _data ), _size );
+#endif
+		}
+
+		_data = nullptr;
+		_size = 0;
+
+		std::lock_guard<std::mutex> lock( _mutex );
+		_decompressed.clear( );
+	}
+
+	bool AssetArchive::Contains( const std::string &name ) const
+	{ return nullptr != Find( GetEntryName( name ) ); }
+
+	bool AssetArchive::GetEntry( const std::string &name, Entry &entry )
+	{
+		const std::string entryName = GetEntryName( name );
+		const IndexEntry *record = Find( entryName );
+
+		if ( nullptr == record || record->_dataOffset + record->_storedSize > _size )
+		{ return false; }
+
+		const char *stored = _data + record->_dataOffset;
+
+		if ( !( record->_flags & FLAGS::LZ4 ) )
+		{
+			entry._data = stored;
+			entry._size = static_cast<std::size_t>( record->_size );
+
+			return true;
+		}
+
+		std::lock_guard<std::mutex> lock( _mutex );
+		auto decompressed = _decompressed.find( entryName );
+
+		if ( decompressed == _decompressed.end( ) )
+		{
+			std::vector<char> buffer( static_cast<std::size_t>( record->_size ) );
+
+			if ( !DecompressLZ4( stored, static_cast<std::size_t>( record->_storedSize ), buffer.data( ), buffer.size( ) ) )
+			{ return false; }
+
+			decompressed = _decompressed.emplace( entryName, std::move( buffer ) ).first;
+		}
+
+		entry._data = decompressed->second.data( );
+		entry._size = decompressed->second.size( );
+
+		return true;
+	}
+
+	unsigned int AssetArchive::GetEntryCount( ) const
+	{
+		if ( nullptr == _data )
+		{ return 0; }
+
+		return reinterpret_cast<const Header *>( _data )->_entryCount;
+	}
+
+	std::string AssetArchive::GetEntryName( const std::string &path )
+	{ return std::filesystem::path( path ).lexically_normal( ).generic_string( ); }
+
+	const AssetArchive::IndexEntry *AssetArchive::Find( const std::string &name ) const
+	{
+		if ( nullptr == _data )
+		{ return nullptr; }
+
+		const IndexEntry *index = reinterpret_cast<const IndexEntry *>( _data + sizeof( Header ) );
+		const IndexEntry *end = index + GetEntryCount( );
+
+		auto nameOf = [this]( const IndexEntry &record )
+		{ return std::string_view( _data + record._nameOffset, record._nameLength ); };
+
+		const IndexEntry *record = std::lower_bound( index, end, name, [&]( const IndexEntry &a, const std::string &b ) { return nameOf( a ) < b; } );
+
+		if ( record == end || nameOf( *record ) != name )
+		{ return nullptr; }
+
+		return record;
+	}
+
+	std::vector<char> AssetArchive::CompressLZ4( const char *source, const std::size_t &size )
+	{
+		std::vector<char> output;
+		output.reserve( size );
+
+		auto writeLength = [&output]( std::size_t length )
+		{
+			for ( ; length >= 255; length -= 255 )
+			{ output.push_back( static_cast<char>( 255 ) ); }
+
+			output.push_back( static_cast<char>( length ) );
+		};
+
+		auto writeSequence = [&]( const std::size_t &literalStart, const std::size_t &literalLength, const std::size_t &offset, const std::size_t &matchLength )
+		{
+			const std::size_t extraMatch = matchLength >= 4 ? matchLength - 4 : 0;
+			const std::uint8_t token = static_cast<std::uint8_t>( ( std::min<std::size_t>( literalLength, 15 ) << 4 ) | ( matchLength > 0 ? std::min<std::size_t>( extraMatch, 15 ) : 0 ) );
+
+			output.push_back( static_cast<char>( token ) );
+
+			if ( literalLength >= 15 )
+			{ writeLength( literalLength - 15 ); }
+
+			output.insert( output.end( ), source + literalStart, source + literalStart + literalLength );
+
+			if ( matchLength > 0 )
+			{
+				output.push_back( static_cast<char>( offset & 0xFF ) );
+				output.push_back( static_cast<char>( ( offset >> 8 ) & 0xFF ) );
+
+				if ( extraMatch >= 15 )
+				{ writeLength( extraMatch - 15 ); }
+			}
+		};
+
+		auto read32 = [source]( const std::size_t &position )
+		{
+			std::uint32_t value;
+			std::memcpy( &value, source + position, sizeof( value ) );
+
+			return value;
+		};
+
+		// The format requires the last match to start at least 12 bytes before the end and the last 5 bytes to be literals
+		const std::size_t matchStartLimit = size > 12 ? size - 12 : 0;
+		const std::size_t matchEndLimit = size > 5 ? size - 5 : 0;
+		const std::size_t noPosition = std::numeric_limits<std::size_t>::max( );
+
+		std::vector<std::size_t> hashTable( 1 << 12, noPosition );
+		std::size_t anchor = 0, position = 0;
+
+		while ( position < matchStartLimit )
+		{
+			const std::uint32_t sequence = read32( position );
+			const std::uint32_t hash = ( sequence * 2654435761u ) >> 20;
+			const std::size_t candidate = hashTable[hash];
+
+			hashTable[hash] = position;
+
+			if ( noPosition == candidate || position - candidate > 65535 || read32( candidate ) != sequence )
+			{
+				position++;
+
+				continue;
+			}
+
+			std::size_t matchLength = 4;
+
+			while ( position + matchLength < matchEndLimit && source[candidate + matchLength] == source[position + matchLength] )
+			{ matchLength++; }
+
+			writeSequence( anchor, position - anchor, position - candidate, matchLength );
+
+			position += matchLength;
+			anchor = position;
+		}
+
+		writeSequence( anchor, size - anchor, 0, 0 );
+
+		return output;
+	}
+
+	bool AssetArchive::DecompressLZ4( const char *source, const std::size_t &sourceSize, char *destination, const std::size_t &destinationSize )
+	{
+		std::size_t input = 0, output = 0;
+
+		auto readLength = [&]( std::size_t &length )
+		{
+			std::uint8_t byte;
+
+			do
+			{
+				if ( input >= sourceSize )
+				{ return false; }
+
+				byte = static_cast<std::uint8_t>( source[input++] );
+				length += byte;
+			}
+			while ( 255 == byte );
+
+			return true;
+		};
+
+		while ( input < sourceSize )
+		{
+			const std::uint8_t token = static_cast<std::uint8_t>( source[input++] );
+			std::size_t literalLength = token >> 4;
+
+			if ( 15 == literalLength && !readLength( literalLength ) )
+			{ return false; }
+
+			if ( input + literalLength > sourceSize || output + literalLength > destinationSize )
+			{ return false; }
+
+			std::memcpy( destination + output, source + input, literalLength );
+			input += literalLength;
+			output += literalLength;
+
+			// The last sequence only has literals
+			if ( input >= sourceSize )
+			{ break; }
+
+			if ( input + 2 > sourceSize )
+			{ return false; }
+
+			const std::size_t offset = static_cast<std::uint8_t>( source[input] ) | ( static_cast<std::uint8_t>( source[input + 1] ) << 8 );
+			input += 2;
+
+			if ( 0 == offset || offset > output )
+			{ return false; }
+
+			std::size_t matchLength = token & 0x0F;
+
+			if ( 15 == matchLength && !readLength( matchLength ) )
+			{ return false; }
+
+			matchLength += 4;
+
+			if ( output + matchLength > destinationSize )
+			{ return false; }
+
+			// Byte by byte as the match may overlap the bytes being written
+			for ( std::size_t i = 0; i < matchLength; i++, output++ )
+			{ destination[output] = destination[output - offset]; }
+		}
+
+		return output == destinationSize;
+	}
+}
@@ -2,27 +2,255 @@
 
 namespace Sonar
 {
+	AssetManager::~AssetManager( )
+	{
+		for ( const auto &archive : _archives )
+		{ TextureCache::getInstance( )->RemoveArchive( archive.get( ) ); }
+	}
+
+	bool AssetManager::OpenArchive( const std::string &fileName )
+	{
+		auto archive = std::make_unique<AssetArchive>( );
+
+		if ( !archive->Open( fileName ) )
+		{ return false; }
+
+		// Sprites load their textures through the texture cache, so it reads from the archive too
+		TextureCache::getInstance( )->AddArchive( archive.get( ) );
+		_archives.push_back( std::move( archive ) );
+
+		return true;
+	}
+
+	bool AssetManager::IsInArchive( const std::string &fileName ) const
+	{ return nullptr != FindArchive( fileName ); }
+
 	void AssetManager::LoadTexture( const std::string &name, const std::string &fileName )
-	{ _textures[name] = std::make_shared<Texture>( fileName); }
+	{
+		AssetArchive *archive = FindArchive( fileName );
+
+		if ( nullptr == archive )
+		{
+			_textures[name] = std::make_shared<Texture>( fileName );
+
+			return;
+		}
+
+		sf::Image image;
+		DecodeImage( archive, fileName, image );
+
+		_textures[name] = std::make_shared<Texture>( );
+		_textures[name]->SetTexture( fileName, image );
+	}
 
 	Texture &AssetManager::GetTexture( const std::string &name ) const
 	{ return *_textures.at( name ); }
 
+	void AssetManager::LoadTextureIntoAtlas( const std::string &name, const std::string &fileName )
+	{
+		if ( !_textureAtlas.AddImage( name, fileName ) )
+		{ LoadTexture( name, fileName ); }
+	}
+
+	bool AssetManager::LoadTextureAtlas( const std::string &fileName )
+	{ return _textureAtlas.LoadFromFile( fileName ); }
+
+	bool AssetManager::IsInTextureAtlas( const std::string &name ) const
+	{ return _textureAtlas.HasRegion( name ); }
+
+	const TextureAtlas::Region &AssetManager::GetTextureAtlasRegion( const std::string &name ) const
+	{ return _textureAtlas.GetRegion( name ); }
+
+	TextureAtlas &AssetManager::GetTextureAtlas( )
+	{ return _textureAtlas; }
+
 	void AssetManager::LoadFont( const std::string &name, const std::string &fileName )
-    { _fonts[name] = std::make_shared<Font>( fileName ); }
+    { _fonts[name] = MakeFont( FindArchive( fileName ), fileName ); }
 
     Font &AssetManager::GetFont( const std::string &name ) const
     { return *_fonts.at( name ); }
 
+    Font &AssetManager::GetFontFromFile( const std::string &fileName )
+    {
+        std::shared_ptr<Font> &font = _fontsByFile[fileName];
+
+        if ( nullptr == font )
+        { font = MakeFont( FindArchive( fileName ), fileName ); }
+
+        return *font;
+    }
+
     void AssetManager::LoadSound( const std::string &name, const std::string &fileName )
-    { _sounds[name] = std::make_shared<Sound>( fileName ); }
+    { _sounds[name] = MakeSound( FindArchive( fileName ), fileName ); }
 
     Sound &AssetManager::GetSound( const std::string &name ) const
     { return *_sounds.at( name ); }
 
     void AssetManager::LoadMusic( const std::string &name, const std::string &fileName )
-    { _musics[name] = std::make_shared<Music>( fileName ); }
+    { _musics[name] = MakeMusic( FindArchive( fileName ), fileName ); }
 
     Music &AssetManager::GetMusic( const std::string &name ) const
     { return *_musics.at( name ); }
+
+    std::shared_future<void> AssetManager::LoadTextureAsync( const std::string &name, const std::string &fileName )
+    {
+        AssetArchive *archive = FindArchive( fileName );
+
+        return QueueLoad( [this, name, fileName, archive]( )
+        {
+            auto image = std::make_shared<sf::Image>( );
+            DecodeImage( archive, fileName, *image );
+
+            // Only the GPU upload is left for the render thread
+            return std::function<void( )>( [this, name, fileName, image]( )
+            {
+                auto texture = std::make_shared<Texture>( );
+                texture->SetTexture( fileName, *image );
+
+                _textures[name] = texture;
+            } );
+        } );
+    }
+
+    std::shared_future<void> AssetManager::LoadFontAsync( const std::string &name, const std::string &fileName )
+    {
+        AssetArchive *archive = FindArchive( fileName );
+
+        return QueueLoad( [this, name, fileName, archive]( )
+        {
+            auto font = MakeFont( archive, fileName );
+
+            return std::function<void( )>( [this, name, font]( ) { _fonts[name] = font; } );
+        } );
+    }
+
+    std::shared_future<void> AssetManager::LoadSoundAsync( const std::string &name, const std::string &fileName )
+    {
+        AssetArchive *archive = FindArchive( fileName );
+
+        return QueueLoad( [this, name, fileName, archive]( )
+        {
+            auto sound = MakeSound( archive, fileName );
+
+            return std::function<void( )>( [this, name, sound]( ) { _sounds[name] = sound; } );
+        } );
+    }
+
+    std::shared_future<void> AssetManager::LoadMusicAsync( const std::string &name, const std::string &fileName )
+    {
+        AssetArchive *archive = FindArchive( fileName );
+
+        return QueueLoad( [this, name, fileName, archive]( )
+        {
+            auto music = MakeMusic( archive, fileName );
+
+            return std::function<void( )>( [this, name, music]( ) { _musics[name] = music; } );
+        } );
+    }
+
+    void AssetManager::Update( )
+    {
+        unsigned int finished = 0;
+
+        for ( auto it = _pendingLoads.begin( ); it != _pendingLoads.end( ) && finished < DEFAULT_ASSET_UPLOADS_PER_FRAME; )
+        {
+            if ( std::future_status::ready != it->_decode.wait_for( std::chrono::seconds( 0 ) ) )
+            {
+                it++;
+
+                continue;
+            }
+
+            try
+            {
+                it->_decode.get( )( );
+                it->_loaded.set_value( );
+            }
+            catch ( ... )
+            { it->_loaded.set_exception( std::current_exception( ) ); }
+
+            it = _pendingLoads.erase( it );
+
+            _loadsFinished++;
+            finished++;
+        }
+    }
+
+    bool AssetManager::IsLoading( ) const
+    { return !_pendingLoads.empty( ); }
+
+    float AssetManager::GetLoadingProgress( ) const
+    { return 0 == _loadsQueued ? 1.0f : static_cast<float>( _loadsFinished ) / _loadsQueued; }
+
+    std::shared_future<void> AssetManager::QueueLoad( std::function<std::function<void( )>( )> decode )
+    {
+        // Start a new batch once everything from the previous one has finished
+        if ( _pendingLoads.empty( ) )
+        { _loadsQueued = _loadsFinished = 0; }
+
+        PendingLoad load;
+        load._decode = _loaders.Enqueue( std::move( decode ) );
+
+        std::shared_future<void> loaded = load._loaded.get_future( ).share( );
+
+        _pendingLoads.push_back( std::move( load ) );
+        _loadsQueued++;
+
+        return loaded;
+    }
+
+    AssetArchive *AssetManager::FindArchive( const std::string &fileName ) const
+    {
+        // Archives opened later override earlier ones
+        for ( auto it = _archives.rbegin( ); it != _archives.rend( ); it++ )
+        {
+            if ( ( *it )->Contains( fileName ) )
+            { return it->get( ); }
+        }
+
+        return nullptr;
+    }
+
+    void AssetManager::DecodeImage( AssetArchive *archive, const std::string &fileName, sf::Image &image )
+    {
+        AssetArchive::Entry entry;
+
+        if ( nullptr != archive && archive->GetEntry( fileName, entry ) )
+        { image.loadFromMemory( entry._data, entry._size ); }
+        else
+        { TextureCache::getInstance( )->DecodeImage( fileName, image ); }
+    }
+
+    std::shared_ptr<Font> AssetManager::MakeFont( AssetArchive *archive, const std::string &fileName )
+    {
+        AssetArchive::Entry entry;
+
+        if ( nullptr == archive || !archive->GetEntry( fileName, entry ) )
+        { return std::make_shared<Font>( fileName ); }
+
+        auto font = std::make_shared<Font>( );
+        font->SetFontData( fileName, entry._data, entry._size );
+
+        return font;
+    }
+
+    std::shared_ptr<Sound> AssetManager::MakeSound( AssetArchive *archive, const std::string &fileName )
+    {
+        AssetArchive::Entry entry;
+
+        if ( nullptr == archive || !archive->GetEntry( fileName, entry ) )
+        { return std::make_shared<Sound>( fileName ); }
+
+        return std::make_shared<Sound>( fileName, entry._data, entry._size );
+    }
+
+    std::shared_ptr<Music> AssetManager::MakeMusic( AssetArchive *archive, const std::string &fileName )
+    {
+        AssetArchive::Entry entry;
+
+        if ( nullptr == archive || !archive->GetEntry( fileName, entry ) )
+        { return std::make_shared<Music>( fileName ); }
+
+        return std::make_shared<Music>( fileName, entry._data, entry._size );
+    }
 }
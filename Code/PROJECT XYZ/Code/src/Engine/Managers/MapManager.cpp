@@ -20,7 +20,12 @@ namespace Sonar
 	}
 
 	MapManager::~MapManager( )
-	{ DeleteMapPointer( ); }
+	{
+		for ( auto &tileMap : _tileMaps )
+		{ tileMap->_map = nullptr; }
+
+		DeleteMapPointer( );
+	}
 
 	void MapManager::InitializeMapWithAValue( const char &value )
 	{
@@ -29,12 +34,19 @@ namespace Sonar
 			for ( unsigned int x = 0; x < _arraySize[0]; x++ )
 			{ _map[y][x] = value; }
 		}
+
+		NotifyMapChanged( );
 	}
 
 	void MapManager::SetValue( const char &value, const unsigned int &posX, const unsigned int &posY )
 	{
-		if ( posX < _arraySize[0] && posY < _arraySize[1] )
-		{ _map[posY][posX] = value; }
+		if ( posX < _arraySize[0] && posY < _arraySize[1] && value != _map[posY][posX] )
+		{
+			_map[posY][posX] = value;
+
+			for ( auto &tileMap : _tileMaps )
+			{ tileMap->OnTileChanged( posX, posY ); }
+		}
 	}
 
 	char MapManager::GetValue( const unsigned int &posX, const unsigned int &posY ) const
@@ -114,6 +126,8 @@ namespace Sonar
 		}
 
 		_arraySize.x = x;
+
+		NotifyMapChanged( );
 	}
 
 	glm::uvec2 MapManager::GetSize( ) const
@@ -127,4 +141,10 @@ namespace Sonar
 
 	void MapManager::DeleteMapPointer( )
 	{ delete _map; }
+
+	void MapManager::NotifyMapChanged( )
+	{
+		for ( auto &tileMap : _tileMaps )
+		{ tileMap->OnMapChanged( ); }
+	}
 }
@@ -0,0 +1,181 @@
+#include "pch.hpp"
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	#include <emmintrin.h>
+	#define BITMASK_SSE2
+#endif
+
+namespace Sonar
+{
+	Bitmask::Bitmask( const sf::Image &image, const unsigned char &alphaLimit )
+	{
+		_width = image.getSize( ).x;
+		_height = image.getSize( ).y;
+		_stride = ( ( _width + 63 ) / 64 ) + 2;
+
+		_words.assign( static_cast<std::size_t>( _stride ) * _height, 0 );
+
+		const sf::Uint8 *pixels = image.getPixelsPtr( );
+
+		if ( nullptr == pixels )
+		{ return; }
+
+		for ( unsigned int y = 0; y < _height; y++ )
+		{
+			std::uint64_t *row = &_words[static_cast<std::size_t>( y ) * _stride];
+			const sf::Uint8 *alpha = pixels + ( static_cast<std::size_t>( y ) * _width * 4 ) + 3;
+
+			for ( unsigned int x = 0; x < _width; x++ )
+			{
+				if ( alpha[x * 4] > alphaLimit )
+				{ row[x >> 6] |= std::uint64_t( 1 ) << ( x & 63 ); }
+			}
+		}
+	}
+
+	bool Bitmask::IsSolid( const int &x, const int &y ) const
+	{
+		if ( x < 0 || y < 0 || x >= static_cast<int>( _width ) || y >= static_cast<int>( _height ) )
+		{ return false; }
+
+		return 0 != ( ( _words[( static_cast<std::size_t>( y ) * _stride ) + ( x >> 6 )] >> ( x & 63 ) ) & 1 );
+	}
+
+	const unsigned int &Bitmask::GetWidth( ) const
+	{ return _width; }
+
+	const unsigned int &Bitmask::GetHeight( ) const
+	{ return _height; }
+
+	bool Bitmask::Test( const Bitmask &maskA, const sf::Sprite &spriteA, const Bitmask &maskB, const sf::Sprite &spriteB )
+	{
+		sf::FloatRect intersection;
+
+		// Nothing to test outside the area both sprites cover
+		if ( !spriteA.getGlobalBounds( ).intersects( spriteB.getGlobalBounds( ), intersection ) )
+		{ return false; }
+
+		const float *matrixA = spriteA.getTransform( ).getMatrix( );
+		const float *matrixB = spriteB.getTransform( ).getMatrix( );
+
+		auto isTranslation = []( const float *matrix )
+		{ return 1.0f == matrix[0] && 0.0f == matrix[1] && 0.0f == matrix[4] && 1.0f == matrix[5]; };
+
+		const sf::IntRect &rectA = spriteA.getTextureRect( );
+		const sf::IntRect &rectB = spriteB.getTextureRect( );
+
+		auto isInside = []( const sf::IntRect &rect, const Bitmask &mask )
+		{ return rect.left >= 0 && rect.top >= 0 && rect.width > 0 && rect.height > 0 && rect.left + rect.width <= static_cast<int>( mask._width ) && rect.top + rect.height <= static_cast<int>( mask._height ); };
+
+		if ( !isTranslation( matrixA ) || !isTranslation( matrixB ) || !isInside( rectA, maskA ) || !isInside( rectB, maskB ) )
+		{ return TestTransformed( maskA, spriteA, maskB, spriteB, intersection ); }
+
+		// Unrotated and unscaled, so the sprites line up pixel for pixel once snapped to whole pixels
+		const glm::ivec2 originA( std::lround( matrixA[12] ), std::lround( matrixA[13] ) );
+		const glm::ivec2 originB( std::lround( matrixB[12] ), std::lround( matrixB[13] ) );
+
+		const glm::ivec2 first = glm::max( originA, originB );
+		const glm::ivec2 last = glm::min( originA + glm::ivec2( rectA.width, rectA.height ), originB + glm::ivec2( rectB.width, rectB.height ) );
+
+		if ( last.x <= first.x || last.y <= first.y )
+		{ return false; }
+
+		return TestRows( maskA, first - originA + glm::ivec2( rectA.left, rectA.top ), maskB, first - originB + glm::ivec2( rectB.left, rectB.top ), last - first );
+	}
+
+	bool Bitmask::TestRows( const Bitmask &maskA, const glm::ivec2 &offsetA, const Bitmask &maskB, const glm::ivec2 &offsetB, const glm::ivec2 &size )
+	{
+		for ( int y = 0; y < size.y; y++ )
+		{
+			const std::uint64_t *rowA = &maskA._words[static_cast<std::size_t>( offsetA.y + y ) * maskA._stride];
+			const std::uint64_t *rowB = &maskB._words[static_cast<std::size_t>( offsetB.y + y ) * maskB._stride];
+
+			int x = 0;
+
+		#ifdef BITMASK_SSE2
+			const int shiftA = offsetA.x & 63, shiftB = offsetB.x & 63;
+			const __m128i rightA = _mm_cvtsi32_si128( shiftA ), leftA = _mm_cvtsi32_si128( 64 - shiftA );
+			const __m128i rightB = _mm_cvtsi32_si128( shiftB ), leftB = _mm_cvtsi32_si128( 64 - shiftB );
+
+			__m128i overlap = _mm_setzero_si128( );
+
+			// Two words of each row at a time, each lane shifted into line (a shift of 64 gives 0, so aligned rows need no special case)
+			for ( ; x + 128 <= size.x; x += 128 )
+			{
+				const std::uint64_t *wordsA = rowA + ( ( offsetA.x + x ) >> 6 );
+				const std::uint64_t *wordsB = rowB + ( ( offsetB.x + x ) >> 6 );
+
+				const __m128i bitsA = _mm_or_si128( _mm_srl_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i *>( wordsA ) ), rightA ), _mm_sll_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i *>( wordsA + 1 ) ), leftA ) );
+				const __m128i bitsB = _mm_or_si128( _mm_srl_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i *>( wordsB ) ), rightB ), _mm_sll_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i *>( wordsB + 1 ) ), leftB ) );
+
+				overlap = _mm_or_si128( overlap, _mm_and_si128( bitsA, bitsB ) );
+			}
+
+			if ( 0xFFFF != _mm_movemask_epi8( _mm_cmpeq_epi8( overlap, _mm_setzero_si128( ) ) ) )
+			{ return true; }
+		#endif
+
+			for ( ; x < size.x; x += 64 )
+			{
+				std::uint64_t bits = GetBits( rowA, offsetA.x + x ) & GetBits( rowB, offsetB.x + x );
+
+				// The last word of the overlap may run past it into pixels outside the other sprite
+				if ( size.x - x < 64 )
+				{ bits &= ( std::uint64_t( 1 ) << ( size.x - x ) ) - 1; }
+
+				if ( 0 != bits )
+				{ return true; }
+			}
+		}
+
+		return false;
+	}
+
+	bool Bitmask::TestTransformed( const Bitmask &maskA, const sf::Sprite &spriteA, const Bitmask &maskB, const sf::Sprite &spriteB, const sf::FloatRect &intersection )
+	{
+		const sf::Transform &inverseA = spriteA.getInverseTransform( );
+		const sf::Transform &inverseB = spriteB.getInverseTransform( );
+
+		const sf::IntRect &rectA = spriteA.getTextureRect( );
+		const sf::IntRect &rectB = spriteB.getTextureRect( );
+
+		// Moving one pixel right in the world moves the same amount through each texture, so points are stepped rather than transformed
+		const sf::Vector2f stepA = inverseA.transformPoint( 1.0f, 0.0f ) - inverseA.transformPoint( 0.0f, 0.0f );
+		const sf::Vector2f stepB = inverseB.transformPoint( 1.0f, 0.0f ) - inverseB.transformPoint( 0.0f, 0.0f );
+
+		const int left = static_cast<int>( std::floor( intersection.left ) ), right = static_cast<int>( std::ceil( intersection.left + intersection.width ) );
+		const int top = static_cast<int>( std::floor( intersection.top ) ), bottom = static_cast<int>( std::ceil( intersection.top + intersection.height ) );
+
+		const float widthA = static_cast<float>( std::abs( rectA.width ) ), heightA = static_cast<float>( std::abs( rectA.height ) );
+		const float widthB = static_cast<float>( std::abs( rectB.width ) ), heightB = static_cast<float>( std::abs( rectB.height ) );
+
+		for ( int y = top; y < bottom; y++ )
+		{
+			sf::Vector2f pointA = inverseA.transformPoint( left + 0.5f, y + 0.5f );
+			sf::Vector2f pointB = inverseB.transformPoint( left + 0.5f, y + 0.5f );
+
+			for ( int x = left; x < right; x++, pointA += stepA, pointB += stepB )
+			{
+				if ( pointA.x < 0 || pointA.y < 0 || pointA.x >= widthA || pointA.y >= heightA || pointB.x < 0 || pointB.y < 0 || pointB.x >= widthB || pointB.y >= heightB )
+				{ continue; }
+
+				if ( maskA.IsSolid( rectA.left + static_cast<int>( pointA.x ), rectA.top + static_cast<int>( pointA.y ) ) && maskB.IsSolid( rectB.left + static_cast<int>( pointB.x ), rectB.top + static_cast<int>( pointB.y ) ) )
+				{ return true; }
+			}
+		}
+
+		return false;
+	}
+
+	std::uint64_t Bitmask::GetBits( const std::uint64_t *row, const int &bit )
+	{
+		const std::uint64_t *words = row + ( bit >> 6 );
+		const int shift = bit & 63;
+
+		// Shifting a 64 bit value by 64 is undefined, so aligned reads are a single word
+		if ( 0 == shift )
+		{ return words[0]; }
+
+		return ( words[0] >> shift ) | ( words[1] << ( 64 - shift ) );
+	}
+}
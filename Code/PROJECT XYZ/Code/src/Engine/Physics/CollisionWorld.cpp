@@ -0,0 +1,572 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	// Occupied cells of an empty world, any cell added widens them to itself
+	static const glm::ivec4 NO_OCCUPIED_CELLS( std::numeric_limits<int>::max( ), std::numeric_limits<int>::max( ), std::numeric_limits<int>::min( ), std::numeric_limits<int>::min( ) );
+
+	CollisionWorld::CollisionWorld( const float &cellSize )
+	{
+		_cellSize = std::max( 1.0f, cellSize );
+		_queryStamp = 0;
+		_occupied = NO_OCCUPIED_CELLS;
+	}
+
+	CollisionWorld::~CollisionWorld( )
+	{ Clear( ); }
+
+	void CollisionWorld::Insert( Drawable &drawable, const SHAPE &shape )
+	{
+		if ( this == drawable._collisionWorld && drawable._colliderIndex < _colliders.size( ) && &drawable == _colliders[drawable._colliderIndex]._drawable )
+		{
+			_colliders[drawable._colliderIndex]._shape = shape;
+
+			return;
+		}
+
+		if ( nullptr != drawable._collisionWorld )
+		{ drawable._collisionWorld->Remove( drawable ); }
+
+		const unsigned int index = static_cast<unsigned int>( _colliders.size( ) );
+
+		drawable._collisionWorld = this;
+		drawable._colliderIndex = index;
+
+		Collider collider;
+		collider._drawable = &drawable;
+		collider._shape = shape;
+		collider._queryStamp = _queryStamp;
+		collider._isDirty = false;
+		collider._isOversized = false;
+
+		CalculateBounds( collider );
+		collider._cells = GetCells( collider._bounds );
+
+		_colliders.push_back( collider );
+
+		AddToCells( index );
+	}
+
+	void CollisionWorld::Remove( Drawable &drawable )
+	{
+		if ( this != drawable._collisionWorld )
+		{ return; }
+
+		const unsigned int index = drawable._colliderIndex;
+
+		drawable._collisionWorld = nullptr;
+
+		// A copied drawable keeps the world pointer but never had a collider of its own
+		if ( index >= _colliders.size( ) || &drawable != _colliders[index]._drawable )
+		{ return; }
+
+		RemoveFromCells( index );
+
+		if ( _colliders[index]._isDirty )
+		{ _dirty.erase( std::find( _dirty.begin( ), _dirty.end( ), index ) ); }
+
+		const unsigned int last = static_cast<unsigned int>( _colliders.size( ) - 1 );
+
+		// Order doesn't matter, so the last collider fills the gap and only its cells need their index changing
+		if ( index != last )
+		{
+			Collider &moved = _colliders[index] = _colliders[last];
+			moved._drawable->_colliderIndex = index;
+
+			if ( moved._isOversized )
+			{ std::replace( _oversized.begin( ), _oversized.end( ), last, index ); }
+			else
+			{
+				for ( int x = moved._cells.x; x <= moved._cells.z; x++ )
+				{
+					for ( int y = moved._cells.y; y <= moved._cells.w; y++ )
+					{
+						auto &indices = _cells[SpatialHash::GetCellKey( x, y )];
+						std::replace( indices.begin( ), indices.end( ), last, index );
+					}
+				}
+			}
+
+			std::replace( _dirty.begin( ), _dirty.end( ), last, index );
+		}
+
+		_colliders.pop_back( );
+	}
+
+	void CollisionWorld::Update( Drawable &drawable )
+	{
+		const unsigned int index = drawable._colliderIndex;
+
+		if ( index >= _colliders.size( ) || &drawable != _colliders[index]._drawable )
+		{ return; }
+
+		// The drawable's SFML object may not have moved yet, so the new bounds are read on the next query
+		if ( !_colliders[index]._isDirty )
+		{
+			_colliders[index]._isDirty = true;
+			_dirty.push_back( index );
+		}
+	}
+
+	void CollisionWorld::Clear( )
+	{
+		for ( auto &collider : _colliders )
+		{ collider._drawable->_collisionWorld = nullptr; }
+
+		_colliders.clear( );
+		_cells.clear( );
+		_oversized.clear( );
+		_dirty.clear( );
+
+		_occupied = NO_OCCUPIED_CELLS;
+	}
+
+	void CollisionWorld::QueryAABB( const glm::vec4 &bounds, std::vector<Drawable *> &results )
+	{
+		results.clear( );
+
+		Refresh( );
+
+		Collider area;
+		area._shape = SHAPE::BOX;
+		area._bounds = glm::vec4( bounds.x, bounds.y, bounds.x + bounds.z, bounds.y + bounds.w );
+
+		ForEachInCells( GetCells( area._bounds ), [&]( const unsigned int &index )
+		{
+			if ( Overlaps( _colliders[index], area ) )
+			{ results.push_back( _colliders[index]._drawable ); }
+		} );
+	}
+
+	void CollisionWorld::QueryCircle( const glm::vec2 &center, const float &radius, std::vector<Drawable *> &results )
+	{
+		results.clear( );
+
+		Refresh( );
+
+		ForEachInCells( GetCells( glm::vec4( center - radius, center + radius ) ), [&]( const unsigned int &index )
+		{
+			if ( OverlapsCircle( _colliders[index], center, radius ) )
+			{ results.push_back( _colliders[index]._drawable ); }
+		} );
+	}
+
+	bool CollisionWorld::Raycast( const glm::vec2 &origin, const glm::vec2 &direction, const float &maximumDistance, RaycastHit &hit )
+	{
+		const float length = glm::length( direction );
+
+		if ( 0 == length || maximumDistance <= 0 )
+		{ return false; }
+
+		Refresh( );
+
+		const glm::vec2 normalised = direction / length;
+		const unsigned int stamp = ++_queryStamp;
+
+		float closest = maximumDistance;
+		bool isHit = false;
+
+		auto test = [&]( Collider &collider )
+		{
+			if ( stamp == collider._queryStamp )
+			{ return; }
+
+			collider._queryStamp = stamp;
+
+			float distance;
+			glm::vec2 normal;
+
+			if ( IntersectRay( collider, origin, normalised, closest, distance, normal ) )
+			{
+				closest = distance;
+				isHit = true;
+
+				hit._drawable = collider._drawable;
+				hit._distance = distance;
+				hit._normal = normal;
+			}
+		};
+
+		for ( const auto &index : _oversized )
+		{ test( _colliders[index] ); }
+
+		// Clip the ray to the occupied cells, past them there is nothing left to hit however long the ray is
+		float enter = 0, leave = closest;
+
+		if ( _occupied.x > _occupied.z )
+		{ leave = -1; }
+
+		for ( int axis = 0; axis < 2 && enter <= leave; axis++ )
+		{
+			const float minimum = _occupied[axis] * _cellSize, maximum = ( _occupied[axis + 2] + 1 ) * _cellSize;
+
+			if ( 0 == normalised[axis] )
+			{
+				if ( origin[axis] < minimum || origin[axis] > maximum )
+				{ leave = -1; }
+
+				continue;
+			}
+
+			const float a = ( minimum - origin[axis] ) / normalised[axis], b = ( maximum - origin[axis] ) / normalised[axis];
+
+			enter = std::max( enter, std::min( a, b ) );
+			leave = std::min( leave, std::max( a, b ) );
+		}
+
+		if ( enter > leave )
+		{
+			if ( isHit )
+			{ hit._point = origin + ( normalised * hit._distance ); }
+
+			return isHit;
+		}
+
+		// Walk the cells the ray passes through in order (Amanatides and Woo), stopping once a hit is closer than the next cell or the ray leaves the occupied cells
+		glm::ivec2 cell = glm::clamp( SpatialHash::GetCell( origin + ( normalised * enter ), _cellSize ), glm::ivec2( _occupied.x, _occupied.y ), glm::ivec2( _occupied.z, _occupied.w ) );
+		const glm::ivec2 step( normalised.x < 0 ? -1 : 1, normalised.y < 0 ? -1 : 1 );
+
+		const float infinity = std::numeric_limits<float>::infinity( );
+		const glm::vec2 delta( 0 != normalised.x ? _cellSize / std::abs( normalised.x ) : infinity, 0 != normalised.y ? _cellSize / std::abs( normalised.y ) : infinity );
+
+		glm::vec2 next;
+		next.x = 0 != normalised.x ? ( ( ( cell.x + ( step.x > 0 ? 1 : 0 ) ) * _cellSize ) - origin.x ) / normalised.x : infinity;
+		next.y = 0 != normalised.y ? ( ( ( cell.y + ( step.y > 0 ? 1 : 0 ) ) * _cellSize ) - origin.y ) / normalised.y : infinity;
+
+		while ( true )
+		{
+			const auto found = _cells.find( SpatialHash::GetCellKey( cell.x, cell.y ) );
+
+			if ( _cells.end( ) != found )
+			{
+				for ( const auto &index : found->second )
+				{ test( _colliders[index] ); }
+			}
+
+			const float exit = std::min( next.x, next.y );
+
+			// Colliders not in this cell can only be entered after leaving it
+			if ( exit > closest || exit > leave )
+			{ break; }
+
+			if ( next.x < next.y )
+			{
+				cell.x += step.x;
+				next.x += delta.x;
+			}
+			else
+			{
+				cell.y += step.y;
+				next.y += delta.y;
+			}
+		}
+
+		if ( isHit )
+		{ hit._point = origin + ( normalised * hit._distance ); }
+
+		return isHit;
+	}
+
+	void CollisionWorld::GetOverlappingPairs( std::vector<std::pair<Drawable *, Drawable *>> &pairs )
+	{
+		pairs.clear( );
+
+		Refresh( );
+
+		for ( const auto &cell : _cells )
+		{
+			const glm::ivec2 position = SpatialHash::GetCellFromKey( cell.first );
+			const auto &indices = cell.second;
+
+			for ( std::size_t i = 0; i < indices.size( ); i++ )
+			{
+				const Collider &a = _colliders[indices[i]];
+
+				for ( std::size_t j = i + 1; j < indices.size( ); j++ )
+				{
+					const Collider &b = _colliders[indices[j]];
+
+					// Pairs sharing several cells are only reported from the first cell they share
+					if ( std::max( a._cells.x, b._cells.x ) != position.x || std::max( a._cells.y, b._cells.y ) != position.y )
+					{ continue; }
+
+					if ( Overlaps( a, b ) )
+					{ pairs.push_back( std::make_pair( a._drawable, b._drawable ) ); }
+				}
+			}
+		}
+
+		// Oversized colliders aren't in any cell, each is checked against the cells it covers and the oversized colliders after it
+		for ( std::size_t i = 0; i < _oversized.size( ); i++ )
+		{
+			const Collider &a = _colliders[_oversized[i]];
+			const unsigned int stamp = ++_queryStamp;
+
+			for ( std::size_t j = i + 1; j < _oversized.size( ); j++ )
+			{
+				const Collider &b = _colliders[_oversized[j]];
+
+				if ( Overlaps( a, b ) )
+				{ pairs.push_back( std::make_pair( a._drawable, b._drawable ) ); }
+			}
+
+			SpatialHash::ForEachCell( _cells, a._cells, [&]( const std::vector<unsigned int> &indices )
+			{
+				for ( const auto &index : indices )
+				{
+					Collider &b = _colliders[index];
+
+					if ( stamp == b._queryStamp )
+					{ continue; }
+
+					b._queryStamp = stamp;
+
+					if ( Overlaps( a, b ) )
+					{ pairs.push_back( std::make_pair( a._drawable, b._drawable ) ); }
+				}
+			} );
+		}
+	}
+
+	unsigned int CollisionWorld::GetColliderCount( ) const
+	{ return static_cast<unsigned int>( _colliders.size( ) ); }
+
+	glm::ivec4 CollisionWorld::GetCells( const glm::vec4 &bounds ) const
+	{ return glm::ivec4( SpatialHash::GetCell( glm::vec2( bounds.x, bounds.y ), _cellSize ), SpatialHash::GetCell( glm::vec2( bounds.z, bounds.w ), _cellSize ) ); }
+
+	bool CollisionWorld::IsOversized( const glm::ivec4 &cells )
+	{ return std::uint64_t( cells.z - cells.x + 1 ) * std::uint64_t( cells.w - cells.y + 1 ) > COLLISION_WORLD_MAX_COLLIDER_CELLS; }
+
+	void CollisionWorld::CalculateBounds( Collider &collider ) const
+	{
+		const glm::vec4 bounds = collider._drawable->GetGlobalBounds( );
+
+		collider._bounds = glm::vec4( bounds.x, bounds.y, bounds.x + bounds.z, bounds.y + bounds.w );
+	}
+
+	void CollisionWorld::AddToCells( const unsigned int &index )
+	{
+		Collider &collider = _colliders[index];
+		const glm::ivec4 &cells = collider._cells;
+
+		collider._isOversized = IsOversized( cells );
+
+		if ( collider._isOversized )
+		{
+			_oversized.push_back( index );
+
+			return;
+		}
+
+		_occupied = glm::ivec4( glm::min( glm::ivec2( _occupied.x, _occupied.y ), glm::ivec2( cells.x, cells.y ) ), glm::max( glm::ivec2( _occupied.z, _occupied.w ), glm::ivec2( cells.z, cells.w ) ) );
+
+		for ( int x = cells.x; x <= cells.z; x++ )
+		{
+			for ( int y = cells.y; y <= cells.w; y++ )
+			{ _cells[SpatialHash::GetCellKey( x, y )].push_back( index ); }
+		}
+	}
+
+	void CollisionWorld::RemoveFromCells( const unsigned int &index )
+	{
+		if ( _colliders[index]._isOversized )
+		{
+			_oversized.erase( std::find( _oversized.begin( ), _oversized.end( ), index ) );
+
+			return;
+		}
+
+		const glm::ivec4 &cells = _colliders[index]._cells;
+
+		for ( int x = cells.x; x <= cells.z; x++ )
+		{
+			for ( int y = cells.y; y <= cells.w; y++ )
+			{
+				auto cell = _cells.find( SpatialHash::GetCellKey( x, y ) );
+
+				if ( _cells.end( ) == cell )
+				{ continue; }
+
+				auto &indices = cell->second;
+				auto found = std::find( indices.begin( ), indices.end( ), index );
+
+				if ( indices.end( ) != found )
+				{
+					*found = indices.back( );
+					indices.pop_back( );
+				}
+
+				if ( indices.empty( ) )
+				{ _cells.erase( cell ); }
+			}
+		}
+
+		// The occupied cells only grow while anything is in them, start again once they are all empty
+		if ( _cells.empty( ) )
+		{ _occupied = NO_OCCUPIED_CELLS; }
+	}
+
+	void CollisionWorld::Refresh( )
+	{
+		for ( const auto &index : _dirty )
+		{
+			Collider &collider = _colliders[index];
+			collider._isDirty = false;
+
+			CalculateBounds( collider );
+
+			const glm::ivec4 cells = GetCells( collider._bounds );
+
+			// Most moves stay within the same cells, only the bounds need updating then
+			if ( cells == collider._cells )
+			{ continue; }
+
+			RemoveFromCells( index );
+			collider._cells = cells;
+			AddToCells( index );
+		}
+
+		_dirty.clear( );
+	}
+
+	template <typename Function>
+	void CollisionWorld::ForEachInCells( const glm::ivec4 &cells, const Function &function )
+	{
+		const unsigned int stamp = ++_queryStamp;
+
+		auto visit = [&]( const std::vector<unsigned int> &indices )
+		{
+			for ( const auto &index : indices )
+			{
+				if ( stamp == _colliders[index]._queryStamp )
+				{ continue; }
+
+				_colliders[index]._queryStamp = stamp;
+
+				function( index );
+			}
+		};
+
+		visit( _oversized );
+		SpatialHash::ForEachCell( _cells, cells, visit );
+	}
+
+	bool CollisionWorld::Overlaps( const Collider &a, const Collider &b )
+	{
+		if ( SHAPE::CIRCLE == b._shape )
+		{
+			const glm::vec2 center( ( b._bounds.x + b._bounds.z ) * 0.5f, ( b._bounds.y + b._bounds.w ) * 0.5f );
+
+			return OverlapsCircle( a, center, std::min( b._bounds.z - b._bounds.x, b._bounds.w - b._bounds.y ) * 0.5f );
+		}
+
+		if ( SHAPE::CIRCLE == a._shape )
+		{ return Overlaps( b, a ); }
+
+		return a._bounds.x < b._bounds.z && a._bounds.z > b._bounds.x && a._bounds.y < b._bounds.w && a._bounds.w > b._bounds.y;
+	}
+
+	bool CollisionWorld::OverlapsCircle( const Collider &collider, const glm::vec2 &center, const float &radius )
+	{
+		const glm::vec4 &bounds = collider._bounds;
+		glm::vec2 difference;
+		float reach = radius;
+
+		if ( SHAPE::CIRCLE == collider._shape )
+		{
+			difference = center - glm::vec2( ( bounds.x + bounds.z ) * 0.5f, ( bounds.y + bounds.w ) * 0.5f );
+			reach += std::min( bounds.z - bounds.x, bounds.w - bounds.y ) * 0.5f;
+		}
+		else
+		{
+			// Distance to the closest point of the box
+			difference = center - glm::clamp( center, glm::vec2( bounds.x, bounds.y ), glm::vec2( bounds.z, bounds.w ) );
+		}
+
+		// Squared on both sides, no square root needed
+		return glm::dot( difference, difference ) <= reach * reach;
+	}
+
+	bool CollisionWorld::IntersectRay( const Collider &collider, const glm::vec2 &origin, const glm::vec2 &direction, const float &maximumDistance, float &distance, glm::vec2 &normal )
+	{
+		const glm::vec4 &bounds = collider._bounds;
+
+		if ( SHAPE::CIRCLE == collider._shape )
+		{
+			const glm::vec2 center( ( bounds.x + bounds.z ) * 0.5f, ( bounds.y + bounds.w ) * 0.5f );
+			const float radius = std::min( bounds.z - bounds.x, bounds.w - bounds.y ) * 0.5f;
+
+			const glm::vec2 offset = origin - center;
+			const float c = glm::dot( offset, offset ) - ( radius * radius );
+
+			// Starting inside counts as a hit straight away
+			if ( c <= 0 )
+			{
+				distance = 0;
+				normal = -direction;
+
+				return true;
+			}
+
+			const float b = glm::dot( offset, direction );
+			const float discriminant = ( b * b ) - c;
+
+			if ( b > 0 || discriminant < 0 )
+			{ return false; }
+
+			const float entry = -b - std::sqrt( discriminant );
+
+			if ( entry > maximumDistance )
+			{ return false; }
+
+			distance = entry;
+			normal = ( offset + ( direction * entry ) ) / radius;
+
+			return true;
+		}
+
+		// Slab test, the ray is inside the box where it is between both pairs of sides at once
+		float entry = 0, exit = maximumDistance;
+		glm::vec2 entryNormal = -direction;
+
+		for ( int axis = 0; axis < 2; axis++ )
+		{
+			const float start = origin[axis], speed = direction[axis];
+			const float minimum = 0 == axis ? bounds.x : bounds.y, maximum = 0 == axis ? bounds.z : bounds.w;
+
+			if ( 0 == speed )
+			{
+				if ( start < minimum || start > maximum )
+				{ return false; }
+
+				continue;
+			}
+
+			float enter = ( minimum - start ) / speed, leave = ( maximum - start ) / speed;
+			float side = -1.0f;
+
+			if ( enter > leave )
+			{
+				std::swap( enter, leave );
+				side = 1.0f;
+			}
+
+			if ( enter > entry )
+			{
+				entry = enter;
+				entryNormal = glm::vec2( 0, 0 );
+				entryNormal[axis] = side;
+			}
+
+			exit = std::min( exit, leave );
+
+			if ( entry > exit )
+			{ return false; }
+		}
+
+		distance = entry;
+		normal = entryNormal;
+
+		return true;
+	}
+}
@@ -0,0 +1,359 @@
+#include "pch.hpp"
+
+namespace Sonar
+{
+	Physics::Physics( const glm::vec2 &gravity )
+	{
+		_world = std::make_unique<b2World>( ToMeters( gravity ) );
+
+		_contactListener._contacts = &_pendingContacts;
+		_world->SetContactListener( &_contactListener );
+
+		_velocityIterations = DEFAULT_PHYSICS_VELOCITY_ITERATIONS;
+		_positionIterations = DEFAULT_PHYSICS_POSITION_ITERATIONS;
+
+		_isThreaded = false;
+		_isStepPending = false;
+		_isStepQueued = false;
+		_isThreadRunning = false;
+		_queuedDt = 0;
+
+		if ( DEFAULT_IS_PHYSICS_THREADED )
+		{ EnableThreading( ); }
+	}
+
+	Physics::~Physics( )
+	{
+		DisableThreading( );
+
+		// The world frees its bodies, drawables outliving it just lose theirs
+		for ( auto drawable : _drawables )
+		{ drawable->_body = nullptr; }
+	}
+
+	void Physics::Step( const float &dt )
+	{
+		if ( !_isThreaded )
+		{
+			// Nothing is drawn while a synchronous step runs, so it is published straight away rather than a step late
+			StepWorld( dt );
+			Publish( );
+
+			return;
+		}
+
+		_isStepPending = true;
+
+		{
+			std::lock_guard<std::mutex> lock( _threadMutex );
+
+			_queuedDt = dt;
+			_isStepQueued = true;
+		}
+
+		_threadCondition.notify_all( );
+	}
+
+	void Physics::Sync( )
+	{
+		if ( _isStepPending )
+		{
+			WaitForStep( );
+			Publish( );
+
+			_isStepPending = false;
+		}
+
+		_contacts.insert( _contacts.end( ), _pendingContacts.begin( ), _pendingContacts.end( ) );
+		_pendingContacts.clear( );
+	}
+
+	bool Physics::PollContact( Contact &contact )
+	{
+		if ( _contacts.empty( ) )
+		{ return false; }
+
+		contact = _contacts.front( );
+		_contacts.pop_front( );
+
+		return true;
+	}
+
+	void Physics::EnableThreading( )
+	{
+		if ( _isThreaded )
+		{ return; }
+
+		_isThreadRunning = true;
+		_isThreaded = true;
+
+		_thread = std::thread( &Physics::RunThread, this );
+	}
+
+	void Physics::DisableThreading( )
+	{
+		if ( !_isThreaded )
+		{ return; }
+
+		WaitForStep( );
+
+		{
+			std::lock_guard<std::mutex> lock( _threadMutex );
+
+			_isThreadRunning = false;
+		}
+
+		_threadCondition.notify_all( );
+		_thread.join( );
+
+		_isThreaded = false;
+	}
+
+	const bool &Physics::IsThreaded( ) const
+	{ return _isThreaded; }
+
+	void Physics::Interpolate( const float &alpha )
+	{
+		// Only the published transforms are read, so this never waits on a step running on the physics thread
+		for ( std::size_t i = 0; i < _drawables.size( ); i++ )
+		{
+			const float previousX = _previous._positionX[i], previousY = _previous._positionY[i], previousAngle = _previous._angle[i];
+			const float currentX = _current._positionX[i], currentY = _current._positionY[i], currentAngle = _current._angle[i];
+
+			// Bodies that didn't move last step only need writing back once
+			const bool isSettled = previousX == currentX && previousY == currentY && previousAngle == currentAngle;
+
+			if ( isSettled && _isSettled[i] )
+			{ continue; }
+
+			const b2Vec2 position( previousX + ( alpha * ( currentX - previousX ) ), previousY + ( alpha * ( currentY - previousY ) ) );
+			const float angle = previousAngle + ( alpha * ( currentAngle - previousAngle ) );
+
+			_drawables[i]->SetPhysicsTransform( ToPixels( position ), glm::degrees( angle ) );
+			_isSettled[i] = isSettled;
+		}
+	}
+
+	b2Body *Physics::Attach( Drawable &drawable, b2BodyDef bodyDef )
+	{
+		if ( nullptr != drawable._body )
+		{ Detach( drawable ); }
+
+		WaitForStep( );
+
+		bodyDef.position = ToMeters( drawable._position );
+		bodyDef.angle = glm::radians( drawable._rotation );
+
+		b2Body *body = _world->CreateBody( &bodyDef );
+		body->SetUserData( &drawable );
+
+		drawable._body = body;
+
+		const std::size_t index = _bodies.size( );
+
+		_bodies.push_back( body );
+		_drawables.push_back( &drawable );
+		_isSettled.push_back( true );
+
+		for ( Transforms *transforms : { &_previous, &_current, &_next } )
+		{
+			transforms->Resize( index + 1 );
+			transforms->Set( index, *body );
+		}
+
+		return body;
+	}
+
+	void Physics::Detach( Drawable &drawable )
+	{
+		if ( nullptr == drawable._body )
+		{ return; }
+
+		WaitForStep( );
+
+		const auto found = std::find( _drawables.begin( ), _drawables.end( ), &drawable );
+
+		if ( _drawables.end( ) != found )
+		{
+			// Order doesn't matter, so the last body fills the gap in every array
+			const std::size_t index = found - _drawables.begin( ), last = _drawables.size( ) - 1;
+
+			_bodies[index] = _bodies[last];
+			_drawables[index] = _drawables[last];
+			_isSettled[index] = _isSettled[last];
+
+			_bodies.pop_back( );
+			_drawables.pop_back( );
+			_isSettled.pop_back( );
+
+			for ( Transforms *transforms : { &_previous, &_current, &_next } )
+			{
+				transforms->Move( last, index );
+				transforms->Resize( last );
+			}
+
+			DestroyBody( drawable._body );
+		}
+
+		// A copied drawable shares the body but was never attached, the body belongs to the original
+		drawable._body = nullptr;
+	}
+
+	b2Body *Physics::CreateBody( const b2BodyDef &bodyDef )
+	{
+		WaitForStep( );
+
+		return _world->CreateBody( &bodyDef );
+	}
+
+	void Physics::DestroyBody( b2Body *body )
+	{
+		if ( nullptr == body )
+		{ return; }
+
+		WaitForStep( );
+
+		// Contacts still queued would point at the body after it's gone
+		auto involves = [&]( const Contact &contact )
+		{ return contact._bodyA == body || contact._bodyB == body; };
+
+		_world->DestroyBody( body );
+
+		_pendingContacts.erase( std::remove_if( _pendingContacts.begin( ), _pendingContacts.end( ), involves ), _pendingContacts.end( ) );
+		_contacts.erase( std::remove_if( _contacts.begin( ), _contacts.end( ), involves ), _contacts.end( ) );
+	}
+
+	b2World *Physics::GetWorld( ) const
+	{ return _world.get( ); }
+
+	void Physics::SetGravity( const glm::vec2 &gravity )
+	{
+		WaitForStep( );
+
+		_world->SetGravity( ToMeters( gravity ) );
+	}
+
+	glm::vec2 Physics::GetGravity( ) const
+	{ return ToPixels( _world->GetGravity( ) ); }
+
+	void Physics::SetIterations( const int &velocityIterations, const int &positionIterations )
+	{
+		WaitForStep( );
+
+		_velocityIterations = std::max( 1, velocityIterations );
+		_positionIterations = std::max( 1, positionIterations );
+	}
+
+	const int &Physics::GetVelocityIterations( ) const
+	{ return _velocityIterations; }
+
+	const int &Physics::GetPositionIterations( ) const
+	{ return _positionIterations; }
+
+	unsigned int Physics::GetAttachedCount( ) const
+	{ return static_cast<unsigned int>( _bodies.size( ) ); }
+
+	float Physics::ToMeters( const float &pixels )
+	{ return pixels / PHYSICS_PIXELS_PER_METER; }
+
+	b2Vec2 Physics::ToMeters( const glm::vec2 &pixels )
+	{ return b2Vec2( pixels.x / PHYSICS_PIXELS_PER_METER, pixels.y / PHYSICS_PIXELS_PER_METER ); }
+
+	float Physics::ToPixels( const float &meters )
+	{ return meters * PHYSICS_PIXELS_PER_METER; }
+
+	glm::vec2 Physics::ToPixels( const b2Vec2 &meters )
+	{ return glm::vec2( meters.x * PHYSICS_PIXELS_PER_METER, meters.y * PHYSICS_PIXELS_PER_METER ); }
+
+	void Physics::Transforms::Swap( Transforms &other )
+	{
+		_positionX.swap( other._positionX );
+		_positionY.swap( other._positionY );
+		_angle.swap( other._angle );
+	}
+
+	void Physics::Transforms::Resize( const std::size_t &size )
+	{
+		_positionX.resize( size );
+		_positionY.resize( size );
+		_angle.resize( size );
+	}
+
+	void Physics::Transforms::Set( const std::size_t &index, const b2Body &body )
+	{
+		const b2Vec2 &position = body.GetPosition( );
+
+		_positionX[index] = position.x;
+		_positionY[index] = position.y;
+		_angle[index] = body.GetAngle( );
+	}
+
+	void Physics::Transforms::Move( const std::size_t &from, const std::size_t &to )
+	{
+		_positionX[to] = _positionX[from];
+		_positionY[to] = _positionY[from];
+		_angle[to] = _angle[from];
+	}
+
+	void Physics::ContactListener::BeginContact( b2Contact *contact )
+	{
+		b2Body *bodyA = contact->GetFixtureA( )->GetBody( ), *bodyB = contact->GetFixtureB( )->GetBody( );
+
+		_contacts->push_back( { Contact::TYPE::BEGIN, bodyA, bodyB, static_cast<Drawable *>( bodyA->GetUserData( ) ), static_cast<Drawable *>( bodyB->GetUserData( ) ) } );
+	}
+
+	void Physics::ContactListener::EndContact( b2Contact *contact )
+	{
+		b2Body *bodyA = contact->GetFixtureA( )->GetBody( ), *bodyB = contact->GetFixtureB( )->GetBody( );
+
+		_contacts->push_back( { Contact::TYPE::END, bodyA, bodyB, static_cast<Drawable *>( bodyA->GetUserData( ) ), static_cast<Drawable *>( bodyB->GetUserData( ) ) } );
+	}
+
+	void Physics::StepWorld( const float &dt )
+	{
+		_world->Step( dt, _velocityIterations, _positionIterations );
+
+		for ( std::size_t i = 0; i < _bodies.size( ); i++ )
+		{ _next.Set( i, *_bodies[i] ); }
+	}
+
+	void Physics::Publish( )
+	{
+		// Rotate the buffers, the oldest becomes the one the next step writes into
+		_previous.Swap( _current );
+		_current.Swap( _next );
+	}
+
+	void Physics::WaitForStep( )
+	{
+		if ( !_isThreaded )
+		{ return; }
+
+		std::unique_lock<std::mutex> lock( _threadMutex );
+
+		_threadCondition.wait( lock, [this]( ) { return !_isStepQueued; } );
+	}
+
+	void Physics::RunThread( )
+	{
+		std::unique_lock<std::mutex> lock( _threadMutex );
+
+		while ( true )
+		{
+			_threadCondition.wait( lock, [this]( ) { return _isStepQueued || !_isThreadRunning; } );
+
+			if ( !_isThreadRunning )
+			{ return; }
+
+			// The game doesn't touch the world until it has waited for this step, so it runs unlocked
+			const float dt = _queuedDt;
+
+			lock.unlock( );
+			StepWorld( dt );
+			lock.lock( );
+
+			_isStepQueued = false;
+			_threadCondition.notify_all( );
+		}
+	}
+}
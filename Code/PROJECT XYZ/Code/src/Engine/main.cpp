@@ -1,10 +1,45 @@
 #include "pch.hpp"
 
-int main( )
+int main( int argc, char *argv[] )
 {
-	Sonar::Game( SCREEN_WIDTH, SCREEN_HEIGHT, WINDOW_TITLE );
+	// --headless runs without a window, --frames N and --seconds S stop the run, --no-render skips drawing and --real-time paces frames with the clock
+	bool isHeadless = false;
+	Sonar::Game::HeadlessSettings headlessSettings;
 
-	return EXIT_SUCCESS;
-}
+	// --pack DIRECTORY ARCHIVE writes an asset archive instead of running the game, --compress LZ4 compresses its entries
+	std::string packDirectory, packArchive;
+	bool isPackCompressed = false;
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		const std::string argument = argv[i];
+
+		if ( "--headless" == argument )
+		{ isHeadless = true; }
+		else if ( "--no-render" == argument )
+		{ headlessSettings._isRendered = false; }
+		else if ( "--real-time" == argument )
+		{ headlessSettings._isRealTime = true; }
+		else if ( "--frames" == argument && i + 1 < argc )
+		{ headlessSettings._frameLimit = std::strtoul( argv[++i], nullptr, 10 ); }
+		else if ( "--seconds" == argument && i + 1 < argc )
+		{ headlessSettings._timeLimit = std::strtof( argv[++i], nullptr ); }
+		else if ( "--pack" == argument && i + 2 < argc )
+		{
+			packDirectory = argv[++i];
+			packArchive = argv[++i];
+		}
+		else if ( "--compress" == argument )
+		{ isPackCompressed = true; }
+	}
 
+	if ( !packDirectory.empty( ) )
+	{ return Sonar::AssetArchive::Pack( packDirectory, packArchive, isPackCompressed ) ? EXIT_SUCCESS : EXIT_FAILURE; }
 
+	if ( isHeadless )
+	{ Sonar::Game( SCREEN_WIDTH, SCREEN_HEIGHT, headlessSettings ); }
+	else
+	{ Sonar::Game( SCREEN_WIDTH, SCREEN_HEIGHT, WINDOW_TITLE ); }
+
+	return EXIT_SUCCESS;
+}
@@ -3,11 +3,13 @@
 
 namespace Sonar
 {
-    /** We need this to easily convert between pixel and real-world coordinates*/
-    static const float SCALE = 30.f;
+    /** We need this to easily convert between pixel and real-world coordinates, shared with the engine so bodies line up with drawables */
+    static const float SCALE = PHYSICS_PIXELS_PER_METER;
 
     PhysicsWorld::PhysicsWorld( GameDataRef data ): _data( data )
     {        
+        World = _data->physics.GetWorld( );
+
         _data->assets.LoadTexture("Ground Texture", "Resources/ground.png");
         //_data->assets.LoadTexture("Box Texture", "Resources/box.png");
 
@@ -28,7 +30,7 @@ namespace Sonar
 
     void PhysicsWorld::Update( float dt )
     {
-        World->Step( dt, 8, 3 );
+        // The engine steps the world with its fixed step, stepping here as well would run it twice as fast
     }
 
     void PhysicsWorld::Draw( float dt )
@@ -5,10 +5,13 @@ namespace Sonar
 {
 	SplashState::SplashState( GameDataRef data ) : _data( data )
 	{
-		ImGui::SFML::Init( _data->window.GetSFMLWindowObject( ) );
+		if ( _data->window.IsHeadless( ) )
+		{ ImGui::SFML::Init( _data->window.GetSFMLWindowObject( ), sf::Vector2f( _data->window.GetSize( ).x, _data->window.GetSize( ).y ) ); }
+		else
+		{ ImGui::SFML::Init( _data->window.GetSFMLWindowObject( ) ); }
 
 
-		am.LoadMusic( "name1", "Resources/Music.ogg" );
+		_data->assets.LoadMusicAsync( "name1", "Resources/Music.ogg" );
 
 		//Sound s( "Resources/Sound Effect.wav" );
 		//s.Play( );
@@ -156,7 +159,6 @@ namespace Sonar
 	void SplashState::Destructor( )
 	{
 		//music->~Music( );
-		am.~AssetManager( );
 	}
 
 	void SplashState::PollInput( const float &dt, Event &event )
@@ -168,7 +170,8 @@ namespace Sonar
 		if ( Event::MouseWheelScrolled == event.type )
 		{
 			progressBar->Increment( );
-			am.GetMusic( "name1" ).Play();
+			if ( !_data->assets.IsLoading( ) )
+			{ _data->assets.GetMusic( "name1" ).Play( ); }
 
 			//mm->RemoveObjectByType( "Test" );
 